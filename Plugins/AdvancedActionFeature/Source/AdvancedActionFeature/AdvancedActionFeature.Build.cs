@@ -26,6 +26,8 @@ public class AdvancedActionFeature : ModuleRules
 			new string[]
 			{
 				"Core",
+				"ProceduralMeshComponent",
+				"RenderCore",
 				// ... add other public dependencies that you statically link with here ...
 			}
 			);
@@ -38,9 +40,8 @@ public class AdvancedActionFeature : ModuleRules
 				"Engine",
 				"Slate",
 				"SlateCore", 
-				"ProceduralMeshComponent",
 				"RHI",
-				"RenderCore",
+				"Json",
 				// ... add private dependencies that you statically link with here ...	
 			}
 			);
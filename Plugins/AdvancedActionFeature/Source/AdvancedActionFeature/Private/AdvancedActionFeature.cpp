@@ -1,6 +1,40 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "AdvancedActionFeature.h"
+#include "AdvancedActionFeatureStats.h"
+
+DEFINE_LOG_CATEGORY(LogAdvancedAction);
+
+DEFINE_STAT(STAT_ProcMeshCut_Begin);
+DEFINE_STAT(STAT_ProcMeshCut_Build);
+DEFINE_STAT(STAT_ProcMeshCut_Extract);
+DEFINE_STAT(STAT_ProcMeshCut_Remap);
+DEFINE_STAT(STAT_ProcMeshCut_Tangents);
+DEFINE_STAT(STAT_ProcMeshCut_Slice);
+DEFINE_STAT(STAT_ProcMeshCut_SkinningData);
+DEFINE_STAT(STAT_ProcMeshCut_CreatePieces);
+DEFINE_STAT(STAT_ProcMeshCut_Hide);
+DEFINE_STAT(STAT_ProcMeshSkinning_Palette);
+DEFINE_STAT(STAT_ProcMeshSkinning_Kernel);
+DEFINE_STAT(STAT_ProcMeshSkinning_Upload);
+DEFINE_STAT(STAT_ProcMeshSkinning_RenderUpdate);
+
+DEFINE_STAT(STAT_ProcMeshCut_ExtractedVertices);
+DEFINE_STAT(STAT_ProcMeshCut_KeptTriangles);
+DEFINE_STAT(STAT_ProcMeshCut_TangentVertices);
+DEFINE_STAT(STAT_ProcMeshSkinning_SkinnedVertices);
+DEFINE_STAT(STAT_ProcMeshCut_PiecesAlive);
+DEFINE_STAT(STAT_ProcMeshSkinning_InterpolatedComponents);
+DEFINE_STAT(STAT_ProcMeshSkinning_SkippedComponents);
+DEFINE_STAT(STAT_ProcMeshSkinning_DataMemory);
+DEFINE_STAT(STAT_ProcMeshCutBudget_QueuedCuts);
+DEFINE_STAT(STAT_ProcMeshCutBudget_DeferredSkinning);
+DEFINE_STAT(STAT_ProcMeshPool_FreeComponents);
+DEFINE_STAT(STAT_ProcMeshPool_Misses);
+DEFINE_STAT(STAT_ProcMeshSkinning_DroppedFrames);
+DEFINE_STAT(STAT_ProcMeshCut_DroppedCapLoops);
+
+CSV_DEFINE_CATEGORY(AdvancedAction, true);
 
 #define LOCTEXT_NAMESPACE "FAdvancedActionFeatureModule"
 
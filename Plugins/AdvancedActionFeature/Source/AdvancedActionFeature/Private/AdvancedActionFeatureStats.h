@@ -0,0 +1,46 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "Stats/Stats.h"
+
+// stat AdvancedAction: 절단/스키닝 단계별 시간과 조각/메모리 카운터
+DECLARE_STATS_GROUP(TEXT("AdvancedAction"), STATGROUP_AdvancedAction, STATCAT_Advanced);
+
+// --- 절단 (Build 이하 단계는 비동기 절단이면 워커 스레드에서 집계) ---
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Cut Begin"), STAT_ProcMeshCut_Begin, STATGROUP_AdvancedAction, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Cut Build"), STAT_ProcMeshCut_Build, STATGROUP_AdvancedAction, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Cut Extract"), STAT_ProcMeshCut_Extract, STATGROUP_AdvancedAction, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Cut Remap"), STAT_ProcMeshCut_Remap, STATGROUP_AdvancedAction, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Cut Tangents"), STAT_ProcMeshCut_Tangents, STATGROUP_AdvancedAction, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Cut Slice"), STAT_ProcMeshCut_Slice, STATGROUP_AdvancedAction, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Cut Skinning Data"), STAT_ProcMeshCut_SkinningData, STATGROUP_AdvancedAction, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Cut Create Pieces"), STAT_ProcMeshCut_CreatePieces, STATGROUP_AdvancedAction, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Cut Hide Original"), STAT_ProcMeshCut_Hide, STATGROUP_AdvancedAction, );
+
+// --- 런타임 스키닝 ---
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Skinning Palette"), STAT_ProcMeshSkinning_Palette, STATGROUP_AdvancedAction, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Skinning Kernel"), STAT_ProcMeshSkinning_Kernel, STATGROUP_AdvancedAction, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Skinning Upload"), STAT_ProcMeshSkinning_Upload, STATGROUP_AdvancedAction, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Skinning Render Update"), STAT_ProcMeshSkinning_RenderUpdate, STATGROUP_AdvancedAction, );
+
+// --- 카운터 ---
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Cut Vertices Extracted"), STAT_ProcMeshCut_ExtractedVertices, STATGROUP_AdvancedAction, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Cut Triangles Kept"), STAT_ProcMeshCut_KeptTriangles, STATGROUP_AdvancedAction, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Cut Tangent Vertices"), STAT_ProcMeshCut_TangentVertices, STATGROUP_AdvancedAction, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Skinned Vertices"), STAT_ProcMeshSkinning_SkinnedVertices, STATGROUP_AdvancedAction, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Pieces Alive"), STAT_ProcMeshCut_PiecesAlive, STATGROUP_AdvancedAction, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Skinning Interpolated Components"), STAT_ProcMeshSkinning_InterpolatedComponents, STATGROUP_AdvancedAction, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Skinning Skipped Components"), STAT_ProcMeshSkinning_SkippedComponents, STATGROUP_AdvancedAction, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Skinning Data Memory"), STAT_ProcMeshSkinning_DataMemory, STATGROUP_AdvancedAction, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Budget Queued Cuts"), STAT_ProcMeshCutBudget_QueuedCuts, STATGROUP_AdvancedAction, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Budget Deferred Skinning"), STAT_ProcMeshCutBudget_DeferredSkinning, STATGROUP_AdvancedAction, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Pool Free Components"), STAT_ProcMeshPool_FreeComponents, STATGROUP_AdvancedAction, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Pool Misses"), STAT_ProcMeshPool_Misses, STATGROUP_AdvancedAction, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Skinning Dropped Frames"), STAT_ProcMeshSkinning_DroppedFrames, STATGROUP_AdvancedAction, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Cut Dropped Cap Loops"), STAT_ProcMeshCut_DroppedCapLoops, STATGROUP_AdvancedAction, );
+
+// CSV 프로파일러 (-csvCategories=AdvancedAction)
+CSV_DECLARE_CATEGORY_EXTERN(AdvancedAction);
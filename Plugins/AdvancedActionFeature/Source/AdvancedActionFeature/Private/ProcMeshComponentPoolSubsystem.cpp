@@ -0,0 +1,167 @@
+#include "ProcMeshComponentPoolSubsystem.h"
+
+#include "AdvancedActionFeature.h"
+#include "AdvancedActionFeatureStats.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "HAL/IConsoleManager.h"
+#include "ProcMeshPieceComponent.h"
+
+static TAutoConsoleVariable<bool> CVarPoolEnable(
+    TEXT("AdvancedAction.Pool.Enable"),
+    true,
+    TEXT("절단 조각용 프로시저럴 메시 컴포넌트를 월드 풀에서 빌리고 돌려줍니다. false이면 매번 생성/파괴합니다."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarPoolPrewarm(
+    TEXT("AdvancedAction.Pool.Prewarm"),
+    8,
+    TEXT("월드 BeginPlay 시 미리 만들어 둘 조각 컴포넌트 수."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarPoolMaxFree(
+    TEXT("AdvancedAction.Pool.MaxFree"),
+    64,
+    TEXT("풀에 대기시킬 수 있는 최대 컴포넌트 수. 넘으면 돌려받은 컴포넌트를 파괴합니다."),
+    ECVF_Default);
+
+UProcMeshComponentPoolSubsystem* UProcMeshComponentPoolSubsystem::GetActive(const UWorld* World)
+{
+    if (!World || !CVarPoolEnable.GetValueOnGameThread())
+    {
+        return nullptr;
+    }
+    return World->GetSubsystem<UProcMeshComponentPoolSubsystem>();
+}
+
+bool UProcMeshComponentPoolSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UProcMeshComponentPoolSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    if (CVarPoolEnable.GetValueOnGameThread())
+    {
+        Prewarm(CVarPoolPrewarm.GetValueOnGameThread());
+    }
+}
+
+void UProcMeshComponentPoolSubsystem::Deinitialize()
+{
+    // 월드 정리 시 풀 액터와 함께 파괴되므로 참조만 놓음
+    FreeComponents.Empty();
+    SET_DWORD_STAT(STAT_ProcMeshPool_FreeComponents, 0);
+    PoolActor = nullptr;
+    Super::Deinitialize();
+}
+
+UProcMeshPieceComponent* UProcMeshComponentPoolSubsystem::CreatePooledComponent()
+{
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return nullptr;
+    }
+
+    if (!IsValid(PoolActor))
+    {
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.Name = MakeUniqueObjectName(World->PersistentLevel, AActor::StaticClass(), TEXT("ProcMeshComponentPool"));
+        SpawnParams.ObjectFlags |= RF_Transient;
+        SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+        PoolActor = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParams);
+        if (!PoolActor)
+        {
+            UE_LOG(LogAdvancedAction, Error, TEXT("ProcMeshComponentPool: 풀 액터 생성에 실패했습니다."));
+            return nullptr;
+        }
+    }
+
+    UProcMeshPieceComponent* Component = NewObject<UProcMeshPieceComponent>(PoolActor, NAME_None, RF_Transient);
+    Component->RegisterComponent();
+    return Component;
+}
+
+void UProcMeshComponentPoolSubsystem::Prewarm(int32 Count)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(UProcMeshComponentPoolSubsystem::Prewarm);
+
+    const int32 TargetCount = FMath::Min(Count, CVarPoolMaxFree.GetValueOnGameThread());
+    while (FreeComponents.Num() < TargetCount)
+    {
+        UProcMeshPieceComponent* Component = CreatePooledComponent();
+        if (!Component) break;
+
+        Deactivate(*Component);
+        FreeComponents.Add(Component);
+    }
+    SET_DWORD_STAT(STAT_ProcMeshPool_FreeComponents, FreeComponents.Num());
+}
+
+UProcMeshPieceComponent* UProcMeshComponentPoolSubsystem::Acquire()
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(UProcMeshComponentPoolSubsystem::Acquire);
+
+    UProcMeshPieceComponent* Component = nullptr;
+    while (!Component && FreeComponents.Num() > 0)
+    {
+        UProcMeshPieceComponent* Candidate = FreeComponents.Pop(EAllowShrinking::No);
+        if (IsValid(Candidate) && Candidate->IsRegistered())
+        {
+            Component = Candidate;
+        }
+    }
+
+    if (!Component)
+    {
+        INC_DWORD_STAT(STAT_ProcMeshPool_Misses);
+        Component = CreatePooledComponent();
+        if (!Component)
+        {
+            return nullptr;
+        }
+    }
+
+    Component->SetVisibility(true);
+    Component->SetHiddenInGame(false);
+    SET_DWORD_STAT(STAT_ProcMeshPool_FreeComponents, FreeComponents.Num());
+    return Component;
+}
+
+void UProcMeshComponentPoolSubsystem::Release(UProcMeshPieceComponent* Component)
+{
+    if (!IsValid(Component))
+    {
+        return;
+    }
+
+    if (!IsPooled(Component) || FreeComponents.Num() >= CVarPoolMaxFree.GetValueOnGameThread())
+    {
+        Component->DestroyComponent();
+        return;
+    }
+
+    Component->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
+    Component->ResetSkinnedFrames();
+    Component->ClearAllMeshSections();
+    Component->EmptyOverrideMaterials();
+    Deactivate(*Component);
+    FreeComponents.AddUnique(Component);
+    SET_DWORD_STAT(STAT_ProcMeshPool_FreeComponents, FreeComponents.Num());
+}
+
+bool UProcMeshComponentPoolSubsystem::IsPooled(const UMeshComponent* Component) const
+{
+    return Component && PoolActor && Component->GetOwner() == PoolActor;
+}
+
+void UProcMeshComponentPoolSubsystem::Deactivate(UProcMeshPieceComponent& Component)
+{
+    Component.SetSimulatePhysics(false);
+    Component.SetCollisionEnabled(ECollisionEnabled::NoCollision);
+    Component.SetVisibility(false);
+    Component.SetHiddenInGame(true);
+}
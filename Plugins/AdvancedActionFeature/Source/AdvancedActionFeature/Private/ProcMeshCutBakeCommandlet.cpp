@@ -0,0 +1,84 @@
+#include "ProcMeshCutBakeCommandlet.h"
+
+#include "AdvancedActionFeature.h"
+#include "AssetRegistry/AssetData.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Misc/PackageName.h"
+#include "ProcMeshCutBakedData.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+
+UProcMeshCutBakeCommandlet::UProcMeshCutBakeCommandlet()
+{
+    IsClient = false;
+    IsEditor = true;
+    IsServer = false;
+    LogToConsole = true;
+}
+
+int32 UProcMeshCutBakeCommandlet::Main(const FString& Params)
+{
+#if WITH_EDITOR
+    FString AssetPath;
+    FParse::Value(*Params, TEXT("Asset="), AssetPath);
+    const bool bSave = !FParse::Param(*Params, TEXT("NoSave"));
+
+    TArray<FSoftObjectPath> AssetsToBake;
+    if (!AssetPath.IsEmpty())
+    {
+        AssetsToBake.Add(FSoftObjectPath(AssetPath));
+    }
+    else
+    {
+        IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
+        AssetRegistry.SearchAllAssets(true);
+
+        TArray<FAssetData> AssetDatas;
+        AssetRegistry.GetAssetsByClass(UProcMeshCutBakedData::StaticClass()->GetClassPathName(), AssetDatas, true);
+        for (const FAssetData& AssetData : AssetDatas)
+        {
+            AssetsToBake.Add(AssetData.GetSoftObjectPath());
+        }
+    }
+
+    int32 NumFailed = 0;
+    for (const FSoftObjectPath& AssetToBake : AssetsToBake)
+    {
+        UProcMeshCutBakedData* BakedData = Cast<UProcMeshCutBakedData>(AssetToBake.TryLoad());
+        if (!BakedData)
+        {
+            UE_LOG(LogAdvancedAction, Error, TEXT("ProcMeshCutBake: '%s'을(를) 불러올 수 없습니다."), *AssetToBake.ToString());
+            ++NumFailed;
+            continue;
+        }
+
+        BakedData->Bake();
+        if (BakedData->BoneCuts.Num() == 0)
+        {
+            UE_LOG(LogAdvancedAction, Error, TEXT("ProcMeshCutBake: '%s' 베이크 결과가 비어 있습니다."), *AssetToBake.ToString());
+            ++NumFailed;
+            continue;
+        }
+
+        if (bSave)
+        {
+            UPackage* Package = BakedData->GetOutermost();
+            const FString Filename = FPackageName::LongPackageNameToFilename(Package->GetName(), FPackageName::GetAssetPackageExtension());
+
+            FSavePackageArgs SaveArgs;
+            SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+            if (!UPackage::SavePackage(Package, BakedData, *Filename, SaveArgs))
+            {
+                UE_LOG(LogAdvancedAction, Error, TEXT("ProcMeshCutBake: '%s' 저장에 실패했습니다."), *Filename);
+                ++NumFailed;
+            }
+        }
+    }
+
+    UE_LOG(LogAdvancedAction, Display, TEXT("ProcMeshCutBake: %d개 에셋 처리, 실패 %d개"), AssetsToBake.Num(), NumFailed);
+    return NumFailed == 0 ? 0 : 1;
+#else
+    UE_LOG(LogAdvancedAction, Error, TEXT("ProcMeshCutBake: 에디터 빌드에서만 실행할 수 있습니다."));
+    return 1;
+#endif
+}
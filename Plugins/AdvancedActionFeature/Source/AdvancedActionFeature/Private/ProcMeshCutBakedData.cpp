@@ -0,0 +1,207 @@
+#include "ProcMeshCutBakedData.h"
+
+#include "AdvancedActionFeature.h"
+#include "Engine/SkeletalMesh.h"
+#include "ProcMeshCutBuilder.h"
+#include "Rendering/SkeletalMeshLODRenderData.h"
+#include "Rendering/SkeletalMeshRenderData.h"
+
+bool UProcMeshCutBakedData::Matches(const USkeletalMesh* InSkeletalMesh, int32 InLODIndex, float InThreshold, bool bInCutBoneSubtree, bool bInRecalculateNormals, bool bInCopyVertexColors) const
+{
+    if (!InSkeletalMesh || SkeletalMesh != InSkeletalMesh || LODIndex != InLODIndex || BoneCuts.Num() == 0)
+    {
+        return false;
+    }
+    if (!FMath::IsNearlyEqual(Threshold, InThreshold) || bCutBoneSubtree != bInCutBoneSubtree
+        || bRecalculateNormals != bInRecalculateNormals || bCopyVertexColors != bInCopyVertexColors)
+    {
+        return false;
+    }
+
+    // 메시가 다시 임포트되어 버텍스 구성이 바뀌었으면 리맵 테이블이 맞지 않음
+    const FSkeletalMeshRenderData* RenderData = InSkeletalMesh->GetResourceForRendering();
+    return RenderData && RenderData->LODRenderData.IsValidIndex(InLODIndex)
+        && static_cast<int32>(RenderData->LODRenderData[InLODIndex].GetNumVertices()) == NumSourceVertices;
+}
+
+const FProcMeshBakedBoneCut* UProcMeshCutBakedData::FindBoneCut(FName BoneName) const
+{
+    return BoneCuts.FindByPredicate([BoneName](const FProcMeshBakedBoneCut& BoneCut) { return BoneCut.BoneName == BoneName; });
+}
+
+bool UProcMeshCutBakedData::BuildCutResult(TConstArrayView<FName> TargetBoneNames, FProcMeshCutResult& OutResult) const
+{
+    OutResult.Reset();
+    if (TargetBoneNames.Num() == 0 || TargetBoneNames.Num() >= FProcMeshCutBuilder::NoCutIndex)
+    {
+        return false;
+    }
+
+    OutResult.SectionMaterialIndices = SectionMaterialIndices;
+    OutResult.OriginalToProcVertexIndices.Init(INDEX_NONE, NumSourceVertices);
+    OutResult.OriginalToCutIndices.Init(FProcMeshCutBuilder::NoCutIndex, NumSourceVertices);
+    OutResult.ProcToOriginalVertexIndices.SetNum(TargetBoneNames.Num());
+
+    for (int32 CutIdx = 0; CutIdx < TargetBoneNames.Num(); ++CutIdx)
+    {
+        const FProcMeshBakedBoneCut* BoneCut = FindBoneCut(TargetBoneNames[CutIdx]);
+        if (!BoneCut)
+        {
+            return false;
+        }
+
+        // 리맵 테이블 복원. 다른 절단이 이미 가진 버텍스가 있으면 단독 베이크 결과를 그대로 쓸 수 없음
+        for (int32 ProcVertexIdx = 0; ProcVertexIdx < BoneCut->SourceVertexIndices.Num(); ++ProcVertexIdx)
+        {
+            const int32 OriginalVertexIdx = BoneCut->SourceVertexIndices[ProcVertexIdx];
+            if (!OutResult.OriginalToCutIndices.IsValidIndex(OriginalVertexIdx) || OutResult.OriginalToCutIndices[OriginalVertexIdx] != FProcMeshCutBuilder::NoCutIndex)
+            {
+                UE_LOG(LogAdvancedAction, Warning, TEXT("ProcMeshCutBakedData '%s': 본 '%s'의 버텍스가 다른 절단 본과 겹쳐 베이크 결과를 쓸 수 없습니다. 런타임에 생성합니다."),
+                    *GetName(), *TargetBoneNames[CutIdx].ToString());
+                return false;
+            }
+            OutResult.OriginalToCutIndices[OriginalVertexIdx] = static_cast<uint8>(CutIdx);
+            OutResult.OriginalToProcVertexIndices[OriginalVertexIdx] = ProcVertexIdx;
+        }
+        OutResult.ProcToOriginalVertexIndices[CutIdx] = BoneCut->SourceVertexIndices;
+
+        for (const FProcMeshBakedPiece& BakedPiece : BoneCut->Pieces)
+        {
+            // 탄젠트 프레임 도입 전에 베이크된 에셋은 스키닝 데이터가 맞지 않으므로 런타임 생성으로 돌아감 (다시 베이크 필요)
+            if (!BakedPiece.SkinningData.IsEmpty() && !BakedPiece.SkinningData.HasBindTangentFrames())
+            {
+                UE_LOG(LogAdvancedAction, Warning, TEXT("ProcMeshCutBakedData '%s': 스키닝 탄젠트 프레임 없이 베이크된 에셋입니다. 다시 베이크하세요."), *GetName());
+                return false;
+            }
+
+            // 바이노멀 부호 도입 전에 베이크된 에셋도 같은 이유로 사용하지 않음
+            if (BakedPiece.TangentFlipY.Num() != BakedPiece.Tangents.Num())
+            {
+                UE_LOG(LogAdvancedAction, Warning, TEXT("ProcMeshCutBakedData '%s': 탄젠트 바이노멀 부호 없이 베이크된 에셋입니다. 다시 베이크하세요."), *GetName());
+                return false;
+            }
+
+            FProcMeshCutPieceData& Piece = OutResult.Pieces.AddDefaulted_GetRef();
+            Piece.CutIndex = CutIdx;
+            Piece.bIsOtherHalf = BakedPiece.bIsOtherHalf;
+            Piece.SkinningData = BakedPiece.SkinningData;
+
+            FProcMeshGeometry& Geometry = Piece.Half.Geometry;
+            Geometry.Vertices = BakedPiece.Vertices;
+            Geometry.Normals = BakedPiece.Normals;
+            Geometry.UV0 = BakedPiece.UV0;
+            Geometry.VertexColors = BakedPiece.VertexColors;
+            Geometry.Tangents.Reserve(BakedPiece.Tangents.Num());
+            for (int32 VertexIdx = 0; VertexIdx < BakedPiece.Tangents.Num(); ++VertexIdx)
+            {
+                Geometry.Tangents.Add(FProcMeshTangent(BakedPiece.Tangents[VertexIdx], BakedPiece.TangentFlipY[VertexIdx]));
+            }
+            Geometry.SectionIndices.SetNum(BakedPiece.Sections.Num());
+            for (int32 SectionIdx = 0; SectionIdx < BakedPiece.Sections.Num(); ++SectionIdx)
+            {
+                Geometry.SectionIndices[SectionIdx] = BakedPiece.Sections[SectionIdx].Indices;
+            }
+            Piece.Half.CapSectionIndex = BakedPiece.CapSectionIndex;
+        }
+    }
+
+    return OutResult.Pieces.Num() > 0;
+}
+
+#if WITH_EDITOR
+void UProcMeshCutBakedData::Bake()
+{
+    NumSourceVertices = 0;
+    SectionMaterialIndices.Reset();
+    BoneCuts.Reset();
+
+    if (!SkeletalMesh)
+    {
+        UE_LOG(LogAdvancedAction, Warning, TEXT("ProcMeshCutBakedData '%s': SkeletalMesh가 지정되지 않았습니다."), *GetName());
+        return;
+    }
+
+    const FReferenceSkeleton& RefSkeleton = SkeletalMesh->GetRefSkeleton();
+    TArray<int32> BoneIndices;
+    if (BonesToBake.Num() > 0)
+    {
+        for (const FName& BoneName : BonesToBake)
+        {
+            const int32 BoneIndex = RefSkeleton.FindBoneIndex(BoneName);
+            if (BoneIndex == INDEX_NONE)
+            {
+                UE_LOG(LogAdvancedAction, Warning, TEXT("ProcMeshCutBakedData '%s': 본 '%s'을(를) 찾을 수 없습니다."), *GetName(), *BoneName.ToString());
+                continue;
+            }
+            BoneIndices.Add(BoneIndex);
+        }
+    }
+    else
+    {
+        for (int32 BoneIndex = 0; BoneIndex < RefSkeleton.GetNum(); ++BoneIndex)
+        {
+            BoneIndices.Add(BoneIndex);
+        }
+    }
+
+    FProcMeshCutSettings Settings;
+    Settings.MinWeight = Threshold;
+    Settings.bCopyVertexColors = bCopyVertexColors;
+    Settings.bRecalculateNormals = bRecalculateNormals;
+    Settings.bCreateCap = true;
+
+    FProcMeshCutBuilder Builder;
+    FProcMeshCutResult Result;
+
+    for (const int32 BoneIndex : BoneIndices)
+    {
+        const int32 TargetBoneIndices[] = { BoneIndex };
+        if (!Settings.Init(*SkeletalMesh, LODIndex, TargetBoneIndices, bCutBoneSubtree))
+        {
+            UE_LOG(LogAdvancedAction, Error, TEXT("ProcMeshCutBakedData '%s': LOD %d의 렌더 데이터를 읽을 수 없습니다."), *GetName(), LODIndex);
+            BoneCuts.Reset();
+            return;
+        }
+        NumSourceVertices = Settings.SourceData->NumVertices();
+
+        // 가중치를 가진 버텍스가 없는 본은 건너뜀
+        if (!Builder.Build(Settings, Result))
+        {
+            continue;
+        }
+        SectionMaterialIndices = Result.SectionMaterialIndices;
+
+        FProcMeshBakedBoneCut& BoneCut = BoneCuts.AddDefaulted_GetRef();
+        BoneCut.BoneName = RefSkeleton.GetBoneName(BoneIndex);
+        BoneCut.SourceVertexIndices = MoveTemp(Result.ProcToOriginalVertexIndices[0]);
+
+        for (FProcMeshCutPieceData& Piece : Result.Pieces)
+        {
+            const FProcMeshGeometry& Geometry = Piece.Half.Geometry;
+            FProcMeshBakedPiece& BakedPiece = BoneCut.Pieces.AddDefaulted_GetRef();
+            BakedPiece.bIsOtherHalf = Piece.bIsOtherHalf;
+            BakedPiece.Vertices = Geometry.Vertices;
+            BakedPiece.Normals = Geometry.Normals;
+            BakedPiece.UV0 = Geometry.UV0;
+            BakedPiece.VertexColors = Geometry.VertexColors;
+            BakedPiece.Tangents.Reserve(Geometry.Tangents.Num());
+            BakedPiece.TangentFlipY.Reserve(Geometry.Tangents.Num());
+            for (const FProcMeshTangent& Tangent : Geometry.Tangents)
+            {
+                BakedPiece.Tangents.Add(Tangent.TangentX);
+                BakedPiece.TangentFlipY.Add(Tangent.bFlipTangentY);
+            }
+            BakedPiece.Sections.SetNum(Geometry.SectionIndices.Num());
+            for (int32 SectionIdx = 0; SectionIdx < Geometry.SectionIndices.Num(); ++SectionIdx)
+            {
+                BakedPiece.Sections[SectionIdx].Indices = Geometry.SectionIndices[SectionIdx];
+            }
+            BakedPiece.CapSectionIndex = Piece.Half.CapSectionIndex;
+            BakedPiece.SkinningData = MoveTemp(Piece.SkinningData);
+        }
+    }
+
+    MarkPackageDirty();
+    UE_LOG(LogAdvancedAction, Log, TEXT("ProcMeshCutBakedData '%s': '%s' LOD %d, 본 %d개 베이크 완료"), *GetName(), *SkeletalMesh->GetName(), LODIndex, BoneCuts.Num());
+}
+#endif
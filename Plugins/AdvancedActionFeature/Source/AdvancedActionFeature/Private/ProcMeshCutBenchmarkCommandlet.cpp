@@ -0,0 +1,297 @@
+#include "ProcMeshCutBenchmarkCommandlet.h"
+
+#include "AdvancedActionFeature.h"
+#include "Dom/JsonObject.h"
+#include "Engine/SkeletalMesh.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "ProcMeshCutBuilder.h"
+#include "ProfilingDebugging/ScopedTimers.h"
+#include "Rendering/SkeletalMeshLODRenderData.h"
+#include "Rendering/SkeletalMeshRenderData.h"
+#include "Serialization/JsonSerializer.h"
+#include "SkelToProcMeshComponent.h"
+
+namespace ProcMeshCutBenchmark
+{
+    /** LOD/본 조합 하나의 측정 결과 (밀리초, 반복/프레임 평균) */
+    struct FRow
+    {
+        int32 LODIndex = 0;
+        FName BoneName;
+        int32 NumPieces = 0;
+        int32 NumPieceVertices = 0;
+        int32 NumHiddenVertices = 0;
+
+        double ExtractMs = 0.0;
+        double RemapMs = 0.0;
+        double TangentsMs = 0.0;
+        double SliceMs = 0.0;
+        double SkinningDataMs = 0.0;
+        double HideMs = 0.0;
+        double SkinPaletteMs = 0.0;
+        double SkinKernelMs = 0.0;
+    };
+
+    /**
+     * 레퍼런스 포즈의 각 본을 프레임/본마다 다른 각도로 흔든 컴포넌트 공간 트랜스폼을 만듭니다.
+     * 애니메이션 에셋 없이도 모든 본 행렬이 프레임마다 바뀌므로 팔레트/커널 비용이 실제와 같습니다.
+     */
+    static void BuildSyntheticPose(const FReferenceSkeleton& RefSkeleton, int32 Frame, TArray<FTransform>& OutComponentSpaceTransforms)
+    {
+        const TArray<FTransform>& RefBonePose = RefSkeleton.GetRefBonePose();
+        const int32 NumBones = RefBonePose.Num();
+        OutComponentSpaceTransforms.SetNumUninitialized(NumBones, EAllowShrinking::No);
+
+        // 부모 인덱스는 항상 자식보다 작으므로 오름차순으로 누적
+        for (int32 BoneIdx = 0; BoneIdx < NumBones; ++BoneIdx)
+        {
+            const float Angle = 0.25f * FMath::Sin(0.2f * Frame + BoneIdx);
+            FTransform LocalTransform = RefBonePose[BoneIdx];
+            LocalTransform.SetRotation(LocalTransform.GetRotation() * FQuat(FVector::XAxisVector, Angle));
+
+            const int32 ParentIdx = RefSkeleton.GetParentIndex(BoneIdx);
+            OutComponentSpaceTransforms[BoneIdx] = ParentIdx == INDEX_NONE ? LocalTransform : LocalTransform * OutComponentSpaceTransforms[ParentIdx];
+        }
+    }
+
+    static FString ToCsv(const FString& MeshName, TConstArrayView<FRow> Rows)
+    {
+        FString Out = TEXT("Mesh,LOD,Bone,Pieces,PieceVertices,HiddenVertices,ExtractMs,RemapMs,TangentsMs,SliceMs,SkinningDataMs,HideMs,SkinPaletteMs,SkinKernelMs\n");
+        for (const FRow& Row : Rows)
+        {
+            Out += FString::Printf(TEXT("%s,%d,%s,%d,%d,%d,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f\n"),
+                *MeshName, Row.LODIndex, *Row.BoneName.ToString(), Row.NumPieces, Row.NumPieceVertices, Row.NumHiddenVertices,
+                Row.ExtractMs, Row.RemapMs, Row.TangentsMs, Row.SliceMs, Row.SkinningDataMs, Row.HideMs, Row.SkinPaletteMs, Row.SkinKernelMs);
+        }
+        return Out;
+    }
+
+    static FString ToJson(const FString& MeshName, int32 NumFrames, int32 NumRepeats, TConstArrayView<FRow> Rows)
+    {
+        TArray<TSharedPtr<FJsonValue>> JsonRows;
+        for (const FRow& Row : Rows)
+        {
+            TSharedRef<FJsonObject> JsonRow = MakeShared<FJsonObject>();
+            JsonRow->SetNumberField(TEXT("lod"), Row.LODIndex);
+            JsonRow->SetStringField(TEXT("bone"), Row.BoneName.ToString());
+            JsonRow->SetNumberField(TEXT("pieces"), Row.NumPieces);
+            JsonRow->SetNumberField(TEXT("pieceVertices"), Row.NumPieceVertices);
+            JsonRow->SetNumberField(TEXT("hiddenVertices"), Row.NumHiddenVertices);
+            JsonRow->SetNumberField(TEXT("extractMs"), Row.ExtractMs);
+            JsonRow->SetNumberField(TEXT("remapMs"), Row.RemapMs);
+            JsonRow->SetNumberField(TEXT("tangentsMs"), Row.TangentsMs);
+            JsonRow->SetNumberField(TEXT("sliceMs"), Row.SliceMs);
+            JsonRow->SetNumberField(TEXT("skinningDataMs"), Row.SkinningDataMs);
+            JsonRow->SetNumberField(TEXT("hideMs"), Row.HideMs);
+            JsonRow->SetNumberField(TEXT("skinPaletteMs"), Row.SkinPaletteMs);
+            JsonRow->SetNumberField(TEXT("skinKernelMs"), Row.SkinKernelMs);
+            JsonRows.Add(MakeShared<FJsonValueObject>(JsonRow));
+        }
+
+        TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+        Root->SetStringField(TEXT("mesh"), MeshName);
+        Root->SetNumberField(TEXT("frames"), NumFrames);
+        Root->SetNumberField(TEXT("repeats"), NumRepeats);
+        Root->SetArrayField(TEXT("results"), JsonRows);
+
+        FString Out;
+        const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Out);
+        FJsonSerializer::Serialize(Root, Writer);
+        return Out;
+    }
+}
+
+UProcMeshCutBenchmarkCommandlet::UProcMeshCutBenchmarkCommandlet()
+{
+    IsClient = false;
+    IsEditor = true;
+    IsServer = false;
+    LogToConsole = true;
+}
+
+int32 UProcMeshCutBenchmarkCommandlet::Main(const FString& Params)
+{
+    using namespace ProcMeshCutBenchmark;
+
+    FString MeshPath;
+    if (!FParse::Value(*Params, TEXT("Mesh="), MeshPath))
+    {
+        UE_LOG(LogAdvancedAction, Error, TEXT("ProcMeshCutBenchmark: -Mesh=<스켈레탈 메시 경로>가 필요합니다."));
+        return 1;
+    }
+
+    USkeletalMesh* SkeletalMesh = Cast<USkeletalMesh>(FSoftObjectPath(MeshPath).TryLoad());
+    const FSkeletalMeshRenderData* RenderData = SkeletalMesh ? SkeletalMesh->GetResourceForRendering() : nullptr;
+    if (!RenderData || RenderData->LODRenderData.Num() == 0)
+    {
+        UE_LOG(LogAdvancedAction, Error, TEXT("ProcMeshCutBenchmark: '%s'을(를) 불러올 수 없거나 렌더 데이터가 없습니다."), *MeshPath);
+        return 1;
+    }
+
+    int32 OnlyLODIndex = INDEX_NONE;
+    FParse::Value(*Params, TEXT("LOD="), OnlyLODIndex);
+    int32 NumFrames = 60;
+    FParse::Value(*Params, TEXT("Frames="), NumFrames);
+    NumFrames = FMath::Max(NumFrames, 0);
+    int32 NumRepeats = 3;
+    FParse::Value(*Params, TEXT("Repeat="), NumRepeats);
+    NumRepeats = FMath::Max(NumRepeats, 1);
+    float Threshold = 0.01f;
+    FParse::Value(*Params, TEXT("Threshold="), Threshold);
+    const bool bCutBoneSubtree = !FParse::Param(*Params, TEXT("NoSubtree"));
+    const bool bRecalculateNormals = !FParse::Param(*Params, TEXT("NoTangents"));
+
+    FString OutputPath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Profiling"), TEXT("ProcMeshCutBenchmark.csv"));
+    FParse::Value(*Params, TEXT("Output="), OutputPath);
+
+    // 측정할 본 (스켈레톤 본 인덱스)
+    const FReferenceSkeleton& RefSkeleton = SkeletalMesh->GetRefSkeleton();
+    TArray<int32> BoneIndices;
+    FString BoneList;
+    if (FParse::Value(*Params, TEXT("Bones="), BoneList, false))
+    {
+        TArray<FString> BoneNames;
+        BoneList.ParseIntoArray(BoneNames, TEXT(","));
+        for (const FString& BoneName : BoneNames)
+        {
+            const int32 BoneIndex = RefSkeleton.FindBoneIndex(FName(*BoneName));
+            if (BoneIndex == INDEX_NONE)
+            {
+                UE_LOG(LogAdvancedAction, Warning, TEXT("ProcMeshCutBenchmark: Bone '%s' not found."), *BoneName);
+                continue;
+            }
+            BoneIndices.Add(BoneIndex);
+        }
+    }
+    else
+    {
+        for (int32 BoneIndex = 0; BoneIndex < RefSkeleton.GetNum(); ++BoneIndex)
+        {
+            BoneIndices.Add(BoneIndex);
+        }
+    }
+
+    // 합성 포즈는 LOD/본과 무관하므로 프레임마다 한 번만 계산
+    TArray<TArray<FTransform>> FramePoses;
+    FramePoses.SetNum(NumFrames);
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        BuildSyntheticPose(RefSkeleton, Frame, FramePoses[Frame]);
+    }
+    const TArray<FMatrix44f>& RefBasesInvMatrix = SkeletalMesh->GetRefBasesInvMatrix();
+
+    FProcMeshCutSettings Settings;
+    Settings.MinWeight = Threshold;
+    Settings.bCopyVertexColors = true;
+    Settings.bRecalculateNormals = bRecalculateNormals;
+    Settings.bCreateCap = true;
+
+    // 빌더/결과/잡은 컴포넌트처럼 재사용해 스크래치 할당이 측정에 섞이지 않게 함
+    FProcMeshCutBuilder Builder;
+    FProcMeshCutResult Result;
+    TArray<FProcMeshSkinningJob> Jobs;
+    TArray<FProcMeshSkinningJob*> JobPtrs;
+    TArray<FLinearColor> OverrideColors;
+    TArray<FRow> Rows;
+
+    const double MsPerRepeat = 1000.0 / NumRepeats;
+    const double MsPerFrame = NumFrames > 0 ? 1000.0 / NumFrames : 0.0;
+
+    for (int32 LODIndex = 0; LODIndex < RenderData->LODRenderData.Num(); ++LODIndex)
+    {
+        if (OnlyLODIndex != INDEX_NONE && LODIndex != OnlyLODIndex) continue;
+
+        const FSkeletalMeshLODRenderData& LODRenderData = RenderData->LODRenderData[LODIndex];
+        for (const int32 BoneIndex : BoneIndices)
+        {
+            const int32 TargetBoneIndices[] = { BoneIndex };
+            if (!Settings.Init(*SkeletalMesh, LODIndex, TargetBoneIndices, bCutBoneSubtree))
+            {
+                UE_LOG(LogAdvancedAction, Error, TEXT("ProcMeshCutBenchmark: LOD %d의 렌더 데이터를 읽을 수 없습니다. (CPU 접근이 가능한 메시인지 확인)"), LODIndex);
+                return 1;
+            }
+
+            FRow Row;
+            Row.LODIndex = LODIndex;
+            Row.BoneName = RefSkeleton.GetBoneName(BoneIndex);
+
+            // 절단 단계: 같은 절단을 반복해 평균
+            bool bBuilt = false;
+            for (int32 Repeat = 0; Repeat < NumRepeats; ++Repeat)
+            {
+                bBuilt = Builder.Build(Settings, Result);
+                Row.ExtractMs += Result.Timings.ExtractSeconds * MsPerRepeat;
+                Row.RemapMs += Result.Timings.RemapSeconds * MsPerRepeat;
+                Row.TangentsMs += Result.Timings.TangentsSeconds * MsPerRepeat;
+                Row.SliceMs += Result.Timings.SliceSeconds * MsPerRepeat;
+                Row.SkinningDataMs += Result.Timings.SkinningDataSeconds * MsPerRepeat;
+
+                double HideSeconds = 0.0;
+                {
+                    FScopedDurationTimer HideTimer(HideSeconds);
+                    Row.NumHiddenVertices = USkelToProcMeshComponent::BuildHiddenVertexColors(LODRenderData, Result.OriginalToCutIndices, OverrideColors);
+                }
+                Row.HideMs += HideSeconds * MsPerRepeat;
+            }
+
+            // 가중치를 가진 버텍스가 없는 본은 건너뜀
+            if (!bBuilt)
+            {
+                continue;
+            }
+
+            // 스키닝 단계: 조각마다 잡을 만들고 프레임마다 팔레트 + 병렬 커널
+            Jobs.SetNum(Result.Pieces.Num());
+            JobPtrs.Reset();
+            Row.NumPieces = Result.Pieces.Num();
+            for (int32 PieceIdx = 0; PieceIdx < Result.Pieces.Num(); ++PieceIdx)
+            {
+                const FProcMeshSkinningBuffer& SkinningData = Result.Pieces[PieceIdx].SkinningData;
+                Row.NumPieceVertices += SkinningData.Num();
+                Jobs[PieceIdx].Reset();
+                if (SkinningData.IsEmpty()) continue;
+
+                Jobs[PieceIdx].Buffer = &SkinningData;
+                JobPtrs.Add(&Jobs[PieceIdx]);
+            }
+
+            double PaletteSeconds = 0.0;
+            double KernelSeconds = 0.0;
+            for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+            {
+                {
+                    FScopedDurationTimer PaletteTimer(PaletteSeconds);
+                    for (FProcMeshSkinningJob* Job : JobPtrs)
+                    {
+                        Job->Buffer->BuildSkinningPalette(RefBasesInvMatrix, FramePoses[Frame], Job->Palette);
+                    }
+                }
+                {
+                    FScopedDurationTimer KernelTimer(KernelSeconds);
+                    ProcMeshSkinning::SkinJobsParallel(JobPtrs);
+                }
+            }
+            Row.SkinPaletteMs = PaletteSeconds * MsPerFrame;
+            Row.SkinKernelMs = KernelSeconds * MsPerFrame;
+
+            UE_LOG(LogAdvancedAction, Display, TEXT("ProcMeshCutBenchmark: LOD %d '%s' 조각 %d (버텍스 %d) 절단 %.3fms, 숨김 %.3fms, 스키닝 %.3fms/프레임"),
+                LODIndex, *Row.BoneName.ToString(), Row.NumPieces, Row.NumPieceVertices,
+                Row.ExtractMs + Row.RemapMs + Row.TangentsMs + Row.SliceMs + Row.SkinningDataMs, Row.HideMs, Row.SkinPaletteMs + Row.SkinKernelMs);
+            Rows.Add(Row);
+        }
+    }
+
+    const FString MeshName = SkeletalMesh->GetName();
+    const FString Report = FPaths::GetExtension(OutputPath).Equals(TEXT("json"), ESearchCase::IgnoreCase)
+        ? ToJson(MeshName, NumFrames, NumRepeats, Rows)
+        : ToCsv(MeshName, Rows);
+    if (!FFileHelper::SaveStringToFile(Report, *OutputPath))
+    {
+        UE_LOG(LogAdvancedAction, Error, TEXT("ProcMeshCutBenchmark: '%s' 저장에 실패했습니다."), *OutputPath);
+        return 1;
+    }
+
+    UE_LOG(LogAdvancedAction, Display, TEXT("ProcMeshCutBenchmark: '%s' 조합 %d개 측정, 결과 '%s'"), *MeshName, Rows.Num(), *OutputPath);
+    return Rows.Num() > 0 ? 0 : 1;
+}
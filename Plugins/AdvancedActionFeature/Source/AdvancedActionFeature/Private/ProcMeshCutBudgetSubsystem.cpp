@@ -0,0 +1,227 @@
+#include "ProcMeshCutBudgetSubsystem.h"
+
+#include "AdvancedActionFeature.h"
+#include "AdvancedActionFeatureStats.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "SkelToProcMeshComponent.h"
+
+static TAutoConsoleVariable<bool> CVarBudgetEnable(
+    TEXT("AdvancedAction.Budget.Enable"),
+    true,
+    TEXT("비동기 절단 요청을 큐에 모으고 조각 스키닝을 프레임 예산으로 배분합니다. false이면 컴포넌트가 각자 즉시 처리합니다."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarBudgetMaxCutsPerFrame(
+    TEXT("AdvancedAction.Budget.MaxCutsPerFrame"),
+    2,
+    TEXT("프레임마다 시작할 수 있는 비동기 절단 수. 0 이하이면 제한하지 않습니다."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarBudgetCutTimeMs(
+    TEXT("AdvancedAction.Budget.CutTimeMs"),
+    2.0f,
+    TEXT("프레임마다 절단 시작(요청 검증, 렌더 데이터 사본 조회)에 쓸 게임 스레드 시간 (ms). 첫 절단은 항상 시작합니다. 0 이하이면 제한하지 않습니다."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarBudgetSkinVerticesPerFrame(
+    TEXT("AdvancedAction.Budget.SkinVerticesPerFrame"),
+    100000,
+    TEXT("프레임마다 스키닝할 수 있는 조각 버텍스 수. 가장 우선순위가 높은 컴포넌트는 예산을 넘어도 허가합니다. 0 이하이면 제한하지 않습니다."),
+    ECVF_Default);
+
+UProcMeshCutBudgetSubsystem* UProcMeshCutBudgetSubsystem::GetActive(const UWorld* World)
+{
+    if (!World || !CVarBudgetEnable.GetValueOnGameThread())
+    {
+        return nullptr;
+    }
+    return World->GetSubsystem<UProcMeshCutBudgetSubsystem>();
+}
+
+bool UProcMeshCutBudgetSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UProcMeshCutBudgetSubsystem::Deinitialize()
+{
+    QueuedCuts.Empty();
+    RegisteredComponents.Empty();
+    Super::Deinitialize();
+}
+
+TStatId UProcMeshCutBudgetSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UProcMeshCutBudgetSubsystem, STATGROUP_AdvancedAction);
+}
+
+void UProcMeshCutBudgetSubsystem::QueueCut(USkelToProcMeshComponent* Component, bool bForceNewPMC, TConstArrayView<FName> TargetBoneNames)
+{
+    RemoveQueuedCut(Component);
+
+    FQueuedCut& QueuedCut = QueuedCuts.AddDefaulted_GetRef();
+    QueuedCut.Component = Component;
+    QueuedCut.TargetBoneNames = TargetBoneNames;
+    QueuedCut.bForceNewPMC = bForceNewPMC;
+    QueuedCut.Sequence = NextQueueSequence++;
+}
+
+void UProcMeshCutBudgetSubsystem::RemoveQueuedCut(const USkelToProcMeshComponent* Component)
+{
+    QueuedCuts.RemoveAll([Component](const FQueuedCut& QueuedCut) { return QueuedCut.Component.Get() == Component; });
+}
+
+void UProcMeshCutBudgetSubsystem::RegisterComponent(USkelToProcMeshComponent* Component)
+{
+    RegisteredComponents.AddUnique(Component);
+}
+
+void UProcMeshCutBudgetSubsystem::UnregisterComponent(USkelToProcMeshComponent* Component)
+{
+    RegisteredComponents.RemoveSwap(Component);
+}
+
+void UProcMeshCutBudgetSubsystem::Tick(float DeltaTime)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(UProcMeshCutBudgetSubsystem::Tick);
+
+    // 우선순위 계산용 플레이어 시점 (분할 화면이면 여러 개)
+    ViewLocations.Reset();
+    for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+    {
+        const APlayerController* PlayerController = It->Get();
+        if (PlayerController && PlayerController->IsLocalController())
+        {
+            FVector ViewLocation;
+            FRotator ViewRotation;
+            PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+            ViewLocations.Add(ViewLocation);
+        }
+    }
+
+    DispatchQueuedCuts();
+    AllocateSkinningBudget();
+}
+
+float UProcMeshCutBudgetSubsystem::ComputeScreenPriority(const USkelToProcMeshComponent& Component) const
+{
+    const AActor* Owner = Component.GetOwner();
+    const USkeletalMeshComponent* SkelComp = Owner ? Owner->FindComponentByClass<USkeletalMeshComponent>() : nullptr;
+    if (!SkelComp || ViewLocations.Num() == 0)
+    {
+        return 1.0f;
+    }
+
+    // 투영 행렬 없이 쓰는 화면 크기 근사: 바운드 반지름 / 시점 거리 (가장 가까운 시점 기준)
+    const FBoxSphereBounds& Bounds = SkelComp->Bounds;
+    double MinDistSquared = UE_BIG_NUMBER;
+    for (const FVector& ViewLocation : ViewLocations)
+    {
+        MinDistSquared = FMath::Min(MinDistSquared, FVector::DistSquared(ViewLocation, Bounds.Origin));
+    }
+    return static_cast<float>(Bounds.SphereRadius / FMath::Max(FMath::Sqrt(MinDistSquared), 1.0));
+}
+
+void UProcMeshCutBudgetSubsystem::DispatchQueuedCuts()
+{
+    QueuedCuts.RemoveAll([](const FQueuedCut& QueuedCut) { return !QueuedCut.Component.IsValid(); });
+    SET_DWORD_STAT(STAT_ProcMeshCutBudget_QueuedCuts, QueuedCuts.Num());
+    if (QueuedCuts.Num() == 0)
+    {
+        return;
+    }
+
+    for (FQueuedCut& QueuedCut : QueuedCuts)
+    {
+        QueuedCut.Priority = ComputeScreenPriority(*QueuedCut.Component.Get());
+    }
+    QueuedCuts.Sort([](const FQueuedCut& A, const FQueuedCut& B)
+    {
+        return A.Priority != B.Priority ? A.Priority > B.Priority : A.Sequence < B.Sequence;
+    });
+
+    const int32 MaxCuts = CVarBudgetMaxCutsPerFrame.GetValueOnGameThread();
+    const double TimeBudgetSeconds = CVarBudgetCutTimeMs.GetValueOnGameThread() * 0.001;
+    const double StartTime = FPlatformTime::Seconds();
+
+    int32 NumDispatched = 0;
+    while (QueuedCuts.Num() > 0)
+    {
+        if (NumDispatched > 0)
+        {
+            if (MaxCuts > 0 && NumDispatched >= MaxCuts) break;
+            if (TimeBudgetSeconds > 0.0 && FPlatformTime::Seconds() - StartTime >= TimeBudgetSeconds) break;
+        }
+
+        // 시작/실패 델리게이트가 다시 큐에 넣을 수 있으므로 먼저 큐에서 꺼냄
+        const FQueuedCut QueuedCut = MoveTemp(QueuedCuts[0]);
+        QueuedCuts.RemoveAt(0, 1, EAllowShrinking::No);
+        ++NumDispatched;
+
+        USkelToProcMeshComponent* Component = QueuedCut.Component.Get();
+        if (!Component) continue;
+
+        Component->bCutQueued = false;
+        if (!Component->StartCutAsync(QueuedCut.bForceNewPMC, QueuedCut.TargetBoneNames))
+        {
+            // 큐에 넣을 때는 성공을 반환했으므로 실패도 델리게이트로 알림
+            Component->OnCutCompleted.Broadcast(false);
+        }
+    }
+}
+
+void UProcMeshCutBudgetSubsystem::AllocateSkinningBudget()
+{
+    struct FCandidate
+    {
+        USkelToProcMeshComponent* Component;
+        int32 NumVertices;
+        float Priority;
+    };
+
+    TArray<FCandidate, TInlineAllocator<64>> Candidates;
+    for (int32 Idx = RegisteredComponents.Num() - 1; Idx >= 0; --Idx)
+    {
+        USkelToProcMeshComponent* Component = RegisteredComponents[Idx].Get();
+        if (!Component)
+        {
+            RegisteredComponents.RemoveAtSwap(Idx, 1, EAllowShrinking::No);
+            continue;
+        }
+        if (!Component->bEnableRuntimeSkinning) continue;
+
+        // 밀린 프레임 수만큼 가중해 낮은 우선순위 컴포넌트도 결국 갱신되도록 함
+        const float Priority = ComputeScreenPriority(*Component) * static_cast<float>(1 + Component->SkinningWaitFrames);
+        Candidates.Add({ Component, Component->GetNumSkinningVertices(), Priority });
+    }
+
+    Candidates.Sort([](const FCandidate& A, const FCandidate& B) { return A.Priority > B.Priority; });
+
+    const int32 VertexBudget = CVarBudgetSkinVerticesPerFrame.GetValueOnGameThread();
+    int32 NumGrantedVertices = 0;
+    int32 NumDeferred = 0;
+    bool bGrantedAny = false;
+    for (const FCandidate& Candidate : Candidates)
+    {
+        // 스키닝할 버텍스가 없으면 예산을 쓰지 않으므로 항상 허용. 예산보다 큰 컴포넌트도 한 프레임에 하나는 허용해 굶지 않게 함
+        const bool bGranted = VertexBudget <= 0 || Candidate.NumVertices == 0 || !bGrantedAny || NumGrantedVertices + Candidate.NumVertices <= VertexBudget;
+        Candidate.Component->bSkinningGranted = bGranted;
+        if (bGranted)
+        {
+            NumGrantedVertices += Candidate.NumVertices;
+            bGrantedAny |= Candidate.NumVertices > 0;
+            Candidate.Component->SkinningWaitFrames = 0;
+        }
+        else
+        {
+            ++Candidate.Component->SkinningWaitFrames;
+            ++NumDeferred;
+        }
+    }
+
+    SET_DWORD_STAT(STAT_ProcMeshCutBudget_DeferredSkinning, NumDeferred);
+    CSV_CUSTOM_STAT(AdvancedAction, BudgetDeferredSkinning, NumDeferred, ECsvCustomStatOp::Set);
+}
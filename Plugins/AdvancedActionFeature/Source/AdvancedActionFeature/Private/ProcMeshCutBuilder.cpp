@@ -0,0 +1,408 @@
+#include "ProcMeshCutBuilder.h"
+
+#include "AdvancedActionFeatureStats.h"
+#include "Engine/SkeletalMesh.h"
+#include "Misc/MemStack.h"
+#include "ProfilingDebugging/ScopedTimers.h"
+#include "ReferenceSkeleton.h"
+
+bool FProcMeshCutSettings::Init(const USkeletalMesh& SkeletalMesh, int32 LODIndex, TConstArrayView<int32> TargetBoneIndices, bool bIncludeBoneSubtree)
+{
+    // 메시/LOD별로 캐시된 불변 사본. 처음 절단하는 메시만 여기서 빌드 비용을 냄
+    USkeletalMeshInfluenceSubsystem* InfluenceSubsystem = USkeletalMeshInfluenceSubsystem::Get();
+    SourceData = InfluenceSubsystem ? InfluenceSubsystem->GetLODSourceData(&SkeletalMesh, LODIndex) : nullptr;
+    InfluenceIndex = InfluenceSubsystem ? InfluenceSubsystem->GetInfluenceIndex(&SkeletalMesh, LODIndex) : nullptr;
+    if (!SourceData || !InfluenceIndex)
+    {
+        return false;
+    }
+
+    FProcMeshCutBuilder::BuildBoneToCutTable(SkeletalMesh.GetRefSkeleton(), TargetBoneIndices, bIncludeBoneSubtree, BoneToCutIndices);
+
+    // 추출한 버텍스는 바인드 포즈 컴포넌트 공간이므로 절단 평면도 같은 공간에서 구성 (기존 SkelComp->GetUpVector()에 해당)
+    const TArray<FMatrix44f>& RefBasesInvMatrix = SkeletalMesh.GetRefBasesInvMatrix();
+    SlicePlanes.Reset(TargetBoneIndices.Num());
+    for (const int32 TargetBoneIndex : TargetBoneIndices)
+    {
+        FVector BindBoneLocation = FVector::ZeroVector;
+        if (RefBasesInvMatrix.IsValidIndex(TargetBoneIndex))
+        {
+            BindBoneLocation = FVector(RefBasesInvMatrix[TargetBoneIndex].Inverse().GetOrigin());
+        }
+        SlicePlanes.Add(FPlane(BindBoneLocation, FVector::UpVector));
+    }
+    return true;
+}
+
+void FProcMeshCutBuilder::BuildBoneToCutTable(const FReferenceSkeleton& RefSkeleton, TConstArrayView<int32> TargetBoneIndices, bool bIncludeBoneSubtree, TArray<uint8>& OutBoneToCutIndices)
+{
+    check(TargetBoneIndices.Num() < NoCutIndex);
+
+    const int32 NumBones = RefSkeleton.GetNum();
+    OutBoneToCutIndices.Init(NoCutIndex, NumBones);
+    for (int32 CutIdx = 0; CutIdx < TargetBoneIndices.Num(); ++CutIdx)
+    {
+        const int32 TargetBoneIndex = TargetBoneIndices[CutIdx];
+        if (TargetBoneIndex >= 0 && TargetBoneIndex < NumBones && OutBoneToCutIndices[TargetBoneIndex] == NoCutIndex)
+        {
+            OutBoneToCutIndices[TargetBoneIndex] = static_cast<uint8>(CutIdx);
+        }
+    }
+
+    // 부모 인덱스는 항상 자식보다 작으므로 오름차순 한 번이면 아래 계층 전체로 전파됨
+    if (bIncludeBoneSubtree)
+    {
+        for (int32 BoneIdx = 1; BoneIdx < NumBones; ++BoneIdx)
+        {
+            const int32 ParentIdx = RefSkeleton.GetParentIndex(BoneIdx);
+            if (OutBoneToCutIndices[BoneIdx] == NoCutIndex && ParentIdx != INDEX_NONE)
+            {
+                OutBoneToCutIndices[BoneIdx] = OutBoneToCutIndices[ParentIdx];
+            }
+        }
+    }
+}
+
+bool FProcMeshCutBuilder::Build(const FProcMeshCutSettings& Settings, FProcMeshCutResult& OutResult)
+{
+    SCOPE_CYCLE_COUNTER(STAT_ProcMeshCut_Build);
+    TRACE_CPUPROFILER_EVENT_SCOPE(ProcMeshCut::Build);
+    CSV_SCOPED_TIMING_STAT(AdvancedAction, CutBuild);
+
+    OutResult.Reset();
+    if (!Settings.SourceData || !Settings.InfluenceIndex || Settings.NumCuts() == 0)
+    {
+        return false;
+    }
+
+    if (!ExtractCuts(Settings, OutResult))
+    {
+        return false;
+    }
+
+    for (int32 CutIdx = 0; CutIdx < Settings.NumCuts(); ++CutIdx)
+    {
+        FProcMeshGeometry& SourceGeometry = CutGeometries[CutIdx];
+        if (!SourceGeometry.HasTriangles())
+        {
+            continue;
+        }
+
+        // 노멀 재계산 (선택 사항). 절단 경계에서 면을 잃은 버텍스만 다시 계산하고 내부는 원본 노멀/탄젠트 유지
+        if (Settings.bRecalculateNormals)
+        {
+            SCOPE_CYCLE_COUNTER(STAT_ProcMeshCut_Tangents);
+            TRACE_CPUPROFILER_EVENT_SCOPE(ProcMeshCut::Tangents);
+            FScopedDurationTimer TangentsTimer(OutResult.Timings.TangentsSeconds);
+            const int32 NumTangentVertices = TangentBuilder.Build(SourceGeometry, CutBoundaryVertices[CutIdx]);
+            INC_DWORD_STAT_BY(STAT_ProcMeshCut_TangentVertices, NumTangentVertices);
+        }
+
+        {
+            SCOPE_CYCLE_COUNTER(STAT_ProcMeshCut_SkinningData);
+            TRACE_CPUPROFILER_EVENT_SCOPE(ProcMeshCut::SkinningData);
+            FScopedDurationTimer SkinningDataTimer(OutResult.Timings.SkinningDataSeconds);
+            BuildSourceSkinningData(*Settings.SourceData, SourceGeometry, OutResult.ProcToOriginalVertexIndices[CutIdx], SourceSkinningData);
+        }
+
+        // 양쪽 절반을 결과 조각에 바로 슬라이스하고, 삼각형이 없는 절반은 뒤에서 제거
+        const int32 FirstPieceIdx = OutResult.Pieces.AddDefaulted(2);
+        {
+            SCOPE_CYCLE_COUNTER(STAT_ProcMeshCut_Slice);
+            TRACE_CPUPROFILER_EVENT_SCOPE(ProcMeshCut::Slice);
+            FScopedDurationTimer SliceTimer(OutResult.Timings.SliceSeconds);
+            Slicer.Slice(SourceGeometry, Settings.SlicePlanes[CutIdx], Settings.bCreateCap, OutResult.Pieces[FirstPieceIdx].Half, OutResult.Pieces[FirstPieceIdx + 1].Half);
+        }
+
+        // 양(+)쪽이 메인, 음(-)쪽이 OtherHalf
+        for (int32 HalfIdx = 1; HalfIdx >= 0; --HalfIdx)
+        {
+            FProcMeshCutPieceData& Piece = OutResult.Pieces[FirstPieceIdx + HalfIdx];
+            if (!Piece.Half.Geometry.HasTriangles())
+            {
+                OutResult.Pieces.RemoveAt(FirstPieceIdx + HalfIdx, 1, EAllowShrinking::No);
+                continue;
+            }
+
+            Piece.CutIndex = CutIdx;
+            Piece.bIsOtherHalf = HalfIdx == 1;
+
+            // 출처를 따라 인플루언스를 전파하고, 바인드 포즈 값은 슬라이스 결과(보간/캡 포함)에서 채움
+            if (SourceSkinningData.IsEmpty() || Piece.Half.Provenance.Num() == 0) continue;
+
+            SCOPE_CYCLE_COUNTER(STAT_ProcMeshCut_SkinningData);
+            TRACE_CPUPROFILER_EVENT_SCOPE(ProcMeshCut::SkinningData);
+            FScopedDurationTimer SkinningDataTimer(OutResult.Timings.SkinningDataSeconds);
+            Piece.SkinningData.InitFromProvenance(SourceSkinningData, Piece.Half.Provenance);
+            const FProcMeshGeometry& Geometry = Piece.Half.Geometry;
+            for (int32 VertexIdx = 0; VertexIdx < Geometry.NumVertices(); ++VertexIdx)
+            {
+                Piece.SkinningData.BindPositions[VertexIdx] = FVector3f(Geometry.Vertices[VertexIdx]);
+                Piece.SkinningData.SetBindTangentFrame(VertexIdx, FVector3f(Geometry.Tangents[VertexIdx].TangentX), FVector3f(Geometry.Normals[VertexIdx]), Geometry.Tangents[VertexIdx].bFlipTangentY);
+            }
+        }
+    }
+
+    return OutResult.Pieces.Num() > 0;
+}
+
+void FProcMeshCutBuilder::Empty()
+{
+    Slicer.Empty();
+    CutGeometries.Empty();
+    SourceSkinningData.Reset();
+    TangentBuilder.Empty();
+    CutBoundaryVertices.Empty();
+}
+
+bool FProcMeshCutBuilder::ExtractCuts(const FProcMeshCutSettings& Settings, FProcMeshCutResult& OutResult)
+{
+    const FSkeletalMeshLODSourceData& SourceData = *Settings.SourceData;
+    const FSkeletalMeshBoneInfluenceIndex& InfluenceIndex = *Settings.InfluenceIndex;
+    const TArray<uint8>& BoneToCutIndices = Settings.BoneToCutIndices;
+
+    const int32 NumVertices = SourceData.NumVertices();
+    const int32 NumCuts = Settings.NumCuts();
+    const int32 NumBones = FMath::Min(InfluenceIndex.NumBones(), BoneToCutIndices.Num());
+    const int32 NumSections = SourceData.Sections.Num();
+
+    if (InfluenceIndex.NumVertices != NumVertices)
+    {
+        return false;
+    }
+
+    // 이 함수 안에서만 쓰는 배정/카운트 배열은 스레드별 선형 스택(FMemStack)에서 LOD 크기만큼 잡고 반환 시 한 번에 되돌림.
+    // 동시에 여러 절단이 워커에서 돌아도 힙 할당자 락을 거치지 않고, 컴포넌트마다 LOD 크기 스크래치를 붙잡아 두지 않음
+    FMemMark ScratchMark(FMemStack::Get());
+
+    // 절단별 슬라이스 전 버텍스 수 / 절단 x 섹션별 인덱스 수 (출력 배열을 한 번에 정확한 크기로 잡기 위함)
+    TArray<int32, TMemStackAllocator<>> CutVertexCounts;
+    CutVertexCounts.SetNumZeroed(NumCuts);
+    TArray<int32, TMemStackAllocator<>> CutSectionIndexCounts;
+    CutSectionIndexCounts.SetNumZeroed(NumCuts * NumSections);
+
+    {
+        SCOPE_CYCLE_COUNTER(STAT_ProcMeshCut_Extract);
+        TRACE_CPUPROFILER_EVENT_SCOPE(ProcMeshCut::Extract);
+        FScopedDurationTimer ExtractTimer(OutResult.Timings.ExtractSeconds);
+
+        // 리맵 테이블: 원본 -> 프로시저럴/절단은 LOD 버텍스 수 크기의 밀집 배열 (해시 조회 없이 O(1))
+        OutResult.OriginalToProcVertexIndices.Init(INDEX_NONE, NumVertices);
+        OutResult.OriginalToCutIndices.Init(NoCutIndex, NumVertices);
+
+        // 1. 버텍스 배정: 절단마다 소속 본들의 버텍스만 색인에서 방문해 가중치를 합산하고, 합이 MinWeight를 넘으면 선택.
+        // 여러 절단에 걸친 버텍스는 합산 가중치가 가장 큰 절단이 차지 (같으면 앞선 절단)
+        TArray<float, TMemStackAllocator<>> ClaimWeights;
+        ClaimWeights.SetNumZeroed(NumVertices);
+        TArray<float, TMemStackAllocator<>> CutWeights;
+        CutWeights.SetNumZeroed(NumVertices);
+        TArray<int32, TMemStackAllocator<>> TouchedVertices;
+
+        for (int32 CutIdx = 0; CutIdx < NumCuts; ++CutIdx)
+        {
+            TouchedVertices.Reset();
+            for (int32 BoneIdx = 0; BoneIdx < NumBones; ++BoneIdx)
+            {
+                if (BoneToCutIndices[BoneIdx] != CutIdx) continue;
+
+                const TConstArrayView<int32> BoneVertices = InfluenceIndex.GetBoneVertices(BoneIdx);
+                const TConstArrayView<float> BoneWeights = InfluenceIndex.GetBoneWeights(BoneIdx);
+                for (int32 EntryIdx = 0; EntryIdx < BoneVertices.Num(); ++EntryIdx)
+                {
+                    const int32 VertexIndex = BoneVertices[EntryIdx];
+                    if (CutWeights[VertexIndex] == 0.0f)
+                    {
+                        TouchedVertices.Add(VertexIndex);
+                    }
+                    CutWeights[VertexIndex] += BoneWeights[EntryIdx];
+                }
+            }
+
+            for (const int32 VertexIndex : TouchedVertices)
+            {
+                const float Weight = CutWeights[VertexIndex];
+                CutWeights[VertexIndex] = 0.0f; // 다음 절단을 위해 방문한 항목만 되돌림
+                if (Weight <= Settings.MinWeight || Weight <= ClaimWeights[VertexIndex]) continue;
+
+                // 앞선 절단이 차지했던 버텍스면 그 절단의 개수에서 뺌
+                const uint8 PreviousCutIdx = OutResult.OriginalToCutIndices[VertexIndex];
+                if (PreviousCutIdx != NoCutIndex)
+                {
+                    --CutVertexCounts[PreviousCutIdx];
+                }
+                ++CutVertexCounts[CutIdx];
+
+                ClaimWeights[VertexIndex] = Weight;
+                OutResult.OriginalToCutIndices[VertexIndex] = static_cast<uint8>(CutIdx);
+            }
+        }
+
+        // 2. 버텍스 버퍼를 한 번 훑으며 배정된 절단의 지오메트리로 복사 (절단 안에서 원본 버텍스 오름차순 유지)
+        // 절단별 개수를 이미 알고 있으므로 Add로 키우지 않고 정확한 크기로 잡은 뒤 커서로 채움
+        const bool bCopyColors = Settings.bCopyVertexColors && SourceData.Colors.Num() == NumVertices;
+
+        CutGeometries.SetNum(NumCuts);
+        CutBoundaryVertices.SetNum(NumCuts);
+        OutResult.ProcToOriginalVertexIndices.SetNum(NumCuts);
+        for (int32 CutIdx = 0; CutIdx < NumCuts; ++CutIdx)
+        {
+            const int32 NumCutVertices = CutVertexCounts[CutIdx];
+            FProcMeshGeometry& Geometry = CutGeometries[CutIdx];
+            Geometry.Reset();
+            Geometry.Vertices.SetNumUninitialized(NumCutVertices);
+            Geometry.Normals.SetNumUninitialized(NumCutVertices);
+            Geometry.Tangents.SetNumUninitialized(NumCutVertices);
+            Geometry.UV0.SetNumUninitialized(NumCutVertices);
+            Geometry.VertexColors.SetNumUninitialized(bCopyColors ? NumCutVertices : 0);
+            OutResult.ProcToOriginalVertexIndices[CutIdx].SetNumUninitialized(NumCutVertices);
+            CutBoundaryVertices[CutIdx].Init(false, Settings.bRecalculateNormals ? NumCutVertices : 0);
+        }
+
+        TArray<int32, TMemStackAllocator<>> CutVertexCursors;
+        CutVertexCursors.SetNumZeroed(NumCuts);
+
+        int32 NumExtractedVertices = 0;
+        for (int32 OriginalSkelVertexIndex = 0; OriginalSkelVertexIndex < NumVertices; ++OriginalSkelVertexIndex)
+        {
+            const uint8 CutIdx = OutResult.OriginalToCutIndices[OriginalSkelVertexIndex];
+            if (CutIdx == NoCutIndex) continue;
+            ++NumExtractedVertices;
+
+            const int32 ProcVertexIdx = CutVertexCursors[CutIdx]++;
+            FProcMeshGeometry& Geometry = CutGeometries[CutIdx];
+            Geometry.Vertices[ProcVertexIdx] = FVector(SourceData.Positions[OriginalSkelVertexIndex]);
+            const FVector4f& TangentZ = SourceData.TangentsZ[OriginalSkelVertexIndex];
+            Geometry.Normals[ProcVertexIdx] = FVector(FVector3f(TangentZ)); // Z는 노멀
+            Geometry.Tangents[ProcVertexIdx] = FProcMeshTangent(FVector(SourceData.TangentsX[OriginalSkelVertexIndex]), TangentZ.W < 0.0f); // X는 탄젠트, Z.W는 바이노멀 부호
+            Geometry.UV0[ProcVertexIdx] = FVector2D(SourceData.UV0[OriginalSkelVertexIndex]); // UV 채널 1개만 가정
+
+            if (bCopyColors)
+            {
+                Geometry.VertexColors[ProcVertexIdx] = SourceData.Colors[OriginalSkelVertexIndex].ReinterpretAsLinear();
+            }
+
+            // 리맵 테이블 업데이트
+            OutResult.ProcToOriginalVertexIndices[CutIdx][ProcVertexIdx] = OriginalSkelVertexIndex;
+            OutResult.OriginalToProcVertexIndices[OriginalSkelVertexIndex] = ProcVertexIdx;
+        }
+
+        INC_DWORD_STAT_BY(STAT_ProcMeshCut_ExtractedVertices, NumExtractedVertices);
+        CSV_CUSTOM_STAT(AdvancedAction, CutVerticesExtracted, NumExtractedVertices, ECsvCustomStatOp::Accumulate);
+    }
+
+    // 3. 인덱스 재구성 (섹션 구조 유지): 세 버텍스가 같은 절단에 속한 삼각형만 그 절단으로.
+    // 첫 번째 패스는 삼각형별 소속 절단과 절단 x 섹션별 개수만 기록하고, 두 번째 패스가 정확한 크기의 인덱스 배열을 채움
+    SCOPE_CYCLE_COUNTER(STAT_ProcMeshCut_Remap);
+    TRACE_CPUPROFILER_EVENT_SCOPE(ProcMeshCut::Remap);
+    FScopedDurationTimer RemapTimer(OutResult.Timings.RemapSeconds);
+    OutResult.SectionMaterialIndices.SetNum(NumSections);
+
+    const TArray<uint32>& GlobalIndexBuffer = SourceData.Indices;
+    TArray<uint8, TMemStackAllocator<>> TriangleCutIndices;
+    TriangleCutIndices.SetNumUninitialized(GlobalIndexBuffer.Num() / 3);
+
+    int32 NumKeptIndices = 0;
+    for (int32 SectionIdx = 0; SectionIdx < NumSections; ++SectionIdx)
+    {
+        const FSkeletalMeshLODSourceData::FSection& Section = SourceData.Sections[SectionIdx];
+        OutResult.SectionMaterialIndices[SectionIdx] = Section.MaterialIndex;
+
+        const uint32 BaseTriangle = Section.BaseIndex / 3;
+        for (uint32 TriIdx = 0; TriIdx < Section.NumTriangles; ++TriIdx)
+        {
+            const uint8 CutIdx = OutResult.OriginalToCutIndices[GlobalIndexBuffer[Section.BaseIndex + TriIdx * 3 + 0]];
+            const bool bKept = CutIdx != NoCutIndex
+                && OutResult.OriginalToCutIndices[GlobalIndexBuffer[Section.BaseIndex + TriIdx * 3 + 1]] == CutIdx
+                && OutResult.OriginalToCutIndices[GlobalIndexBuffer[Section.BaseIndex + TriIdx * 3 + 2]] == CutIdx; // 세 버텍스 모두 같은 절단에 배정되었으면
+            TriangleCutIndices[BaseTriangle + TriIdx] = bKept ? CutIdx : NoCutIndex;
+            if (bKept)
+            {
+                CutSectionIndexCounts[CutIdx * NumSections + SectionIdx] += 3;
+                NumKeptIndices += 3;
+            }
+            else if (Settings.bRecalculateNormals)
+            {
+                // 버려지는 삼각형에 걸친 버텍스는 면을 잃었으므로 노멀 재계산 대상 (면이 모두 남은 버텍스는 원본 노멀이 그대로 유효)
+                for (int32 Corner = 0; Corner < 3; ++Corner)
+                {
+                    const uint32 OriginalVertexIndex = GlobalIndexBuffer[Section.BaseIndex + TriIdx * 3 + Corner];
+                    const uint8 CornerCutIdx = OutResult.OriginalToCutIndices[OriginalVertexIndex];
+                    if (CornerCutIdx != NoCutIndex)
+                    {
+                        CutBoundaryVertices[CornerCutIdx][OutResult.OriginalToProcVertexIndices[OriginalVertexIndex]] = true;
+                    }
+                }
+            }
+        }
+    }
+
+    for (int32 CutIdx = 0; CutIdx < NumCuts; ++CutIdx)
+    {
+        FProcMeshGeometry& Geometry = CutGeometries[CutIdx];
+        Geometry.SectionIndices.SetNum(NumSections);
+        for (int32 SectionIdx = 0; SectionIdx < NumSections; ++SectionIdx)
+        {
+            Geometry.SectionIndices[SectionIdx].SetNumUninitialized(CutSectionIndexCounts[CutIdx * NumSections + SectionIdx]);
+        }
+    }
+
+    for (int32 SectionIdx = 0; SectionIdx < NumSections; ++SectionIdx)
+    {
+        const FSkeletalMeshLODSourceData::FSection& Section = SourceData.Sections[SectionIdx];
+        const uint32 BaseTriangle = Section.BaseIndex / 3;
+
+        // 절단별 쓰기 커서는 위에서 쓴 개수 배열을 재사용 (섹션 하나씩 0부터)
+        for (int32 CutIdx = 0; CutIdx < NumCuts; ++CutIdx)
+        {
+            CutSectionIndexCounts[CutIdx * NumSections + SectionIdx] = 0;
+        }
+
+        for (uint32 TriIdx = 0; TriIdx < Section.NumTriangles; ++TriIdx)
+        {
+            const uint8 CutIdx = TriangleCutIndices[BaseTriangle + TriIdx];
+            if (CutIdx == NoCutIndex) continue;
+
+            int32& Cursor = CutSectionIndexCounts[CutIdx * NumSections + SectionIdx];
+            int32* Dest = CutGeometries[CutIdx].SectionIndices[SectionIdx].GetData() + Cursor;
+            Dest[0] = OutResult.OriginalToProcVertexIndices[GlobalIndexBuffer[Section.BaseIndex + TriIdx * 3 + 0]];
+            Dest[1] = OutResult.OriginalToProcVertexIndices[GlobalIndexBuffer[Section.BaseIndex + TriIdx * 3 + 1]];
+            Dest[2] = OutResult.OriginalToProcVertexIndices[GlobalIndexBuffer[Section.BaseIndex + TriIdx * 3 + 2]];
+            Cursor += 3;
+        }
+    }
+
+    INC_DWORD_STAT_BY(STAT_ProcMeshCut_KeptTriangles, NumKeptIndices / 3);
+    CSV_CUSTOM_STAT(AdvancedAction, CutTrianglesKept, NumKeptIndices / 3, ECsvCustomStatOp::Accumulate);
+
+    // 삼각형이 남은 절단이 하나라도 있어야 성공
+    return NumKeptIndices > 0;
+}
+
+void FProcMeshCutBuilder::BuildSourceSkinningData(const FSkeletalMeshLODSourceData& SourceData, const FProcMeshGeometry& Geometry, TConstArrayView<int32> ProcToOriginalVertexIndices, FProcMeshSkinningBuffer& OutSkinningData)
+{
+    OutSkinningData.Reset();
+
+    const int32 MaxInfluences = SourceData.MaxInfluences;
+    const int32 NumProcVertices = Geometry.NumVertices();
+    if (MaxInfluences == 0 || NumProcVertices == 0 || ProcToOriginalVertexIndices.Num() != NumProcVertices)
+    {
+        return;
+    }
+
+    // 프로시저럴 메시 버텍스 수만큼 고정 폭 슬롯을 한 번에 할당
+    OutSkinningData.Init(NumProcVertices, MaxInfluences);
+
+    for (int32 ProcVertexIdx = 0; ProcVertexIdx < NumProcVertices; ++ProcVertexIdx)
+    {
+        // 바인드 포즈 위치/탄젠트 프레임은 인덱스가 그대로 대응하므로 연속 배열로 바로 복사
+        OutSkinningData.BindPositions[ProcVertexIdx] = FVector3f(Geometry.Vertices[ProcVertexIdx]);
+        OutSkinningData.SetBindTangentFrame(ProcVertexIdx, FVector3f(Geometry.Tangents[ProcVertexIdx].TangentX), FVector3f(Geometry.Normals[ProcVertexIdx]), Geometry.Tangents[ProcVertexIdx].bFlipTangentY);
+
+        // 인플루언스 슬롯은 원본 버텍스의 (스켈레톤 본 기준) 스킨 웨이트에서 채움. 빈 슬롯은 가중치 0이므로 버퍼에서 걸러짐
+        const int32 FirstSlot = ProcToOriginalVertexIndices[ProcVertexIdx] * MaxInfluences;
+        OutSkinningData.SetVertexInfluences(ProcVertexIdx, &SourceData.InfluenceBones[FirstSlot], &SourceData.InfluenceWeights[FirstSlot], MaxInfluences);
+    }
+
+    // 조각이 실제로 참조하는 본만 팔레트로 압축 (틱마다 이 본들에 대해서만 스킨 행렬 계산)
+    OutSkinningData.CompactBonePalette();
+}
@@ -0,0 +1,177 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProcMeshSkinning.h"
+#include "ProcMeshSlicer.h"
+#include "ProcMeshTangentBuilder.h"
+#include "SkeletalMeshInfluenceSubsystem.h"
+
+class USkeletalMesh;
+struct FReferenceSkeleton;
+
+/** 절단 한 번의 입력. 게임 스레드에서 채운 뒤에는 읽기 전용이며 UObject를 참조하지 않습니다. */
+struct FProcMeshCutSettings
+{
+    // 메시/LOD의 불변 사본 (서브시스템 캐시와 공유)
+    USkeletalMeshInfluenceSubsystem::FLODSourceDataPtr SourceData;
+    USkeletalMeshInfluenceSubsystem::FInfluenceIndexPtr InfluenceIndex;
+
+    // 스켈레톤 본 -> 소속 절단 (FProcMeshCutBuilder::BuildBoneToCutTable)
+    TArray<uint8> BoneToCutIndices;
+
+    // 절단별 평면 (바인드 포즈 컴포넌트 공간). 개수가 절단 수
+    TArray<FPlane> SlicePlanes;
+
+    float MinWeight = 0.f;
+    bool bCopyVertexColors = true;
+    bool bRecalculateNormals = false;
+    bool bCreateCap = true;
+
+    int32 NumCuts() const { return SlicePlanes.Num(); }
+
+    /**
+     * 메시/LOD의 캐시된 사본과 본 -> 절단 테이블, 절단 평면을 채웁니다. 게임 스레드 전용
+     * 평면 위치는 대상 본의 바인드 포즈 위치, 법선은 컴포넌트 Up 축입니다.
+     * 가중치/컬러/노멀 옵션은 건드리지 않습니다.
+     * @param TargetBoneIndices 절단 본 (스켈레톤 본 인덱스, 순서가 CutIndex). INDEX_NONE은 아무 버텍스도 선택하지 않음
+     * @return 렌더 데이터 사본이나 인플루언스 색인을 만들 수 없으면 false
+     */
+    bool Init(const USkeletalMesh& SkeletalMesh, int32 LODIndex, TConstArrayView<int32> TargetBoneIndices, bool bIncludeBoneSubtree);
+};
+
+/** 절단 결과 조각 하나 (슬라이스된 절반 + 스키닝 데이터) */
+struct FProcMeshCutPieceData
+{
+    int32 CutIndex = INDEX_NONE;
+    bool bIsOtherHalf = false;
+    FProcMeshSliceHalf Half;
+    FProcMeshSkinningBuffer SkinningData;
+};
+
+/** 빌더 단계별 소요 시간 (초, 절단 전체 누적). 벤치마크 커맨드렛이 읽습니다. */
+struct FProcMeshCutStageTimings
+{
+    // 버텍스 배정 + 버텍스 버퍼 복사
+    double ExtractSeconds = 0.0;
+
+    // 인덱스 버퍼를 리맵 테이블로 재구성
+    double RemapSeconds = 0.0;
+
+    // 노멀/탄젠트 재계산 (bRecalculateNormals일 때만, 절단 경계 버텍스 대상)
+    double TangentsSeconds = 0.0;
+
+    double SliceSeconds = 0.0;
+
+    // 슬라이스 전/후 스키닝 데이터 구성
+    double SkinningDataSeconds = 0.0;
+};
+
+/** 절단 한 번의 출력 */
+struct FProcMeshCutResult
+{
+    // 절단 순서, 절단마다 양(+)쪽 -> 음(-)쪽. 삼각형이 없는 절반은 빠짐
+    TArray<FProcMeshCutPieceData> Pieces;
+
+    // 섹션별 머티리얼 인덱스 (캡 섹션 제외)
+    TArray<int32> SectionMaterialIndices;
+
+    // 원본 LOD 버텍스 -> 소속 절단의 슬라이스 전 버텍스 (선택되지 않으면 INDEX_NONE)
+    TArray<int32> OriginalToProcVertexIndices;
+
+    // 원본 LOD 버텍스 -> 소속 절단 (선택되지 않으면 NoCutIndex)
+    TArray<uint8> OriginalToCutIndices;
+
+    // 절단별 슬라이스 전 버텍스 -> 원본 LOD 버텍스
+    TArray<TArray<int32>> ProcToOriginalVertexIndices;
+
+    // Build에서만 채워짐 (베이크 데이터에서 만든 결과는 0)
+    FProcMeshCutStageTimings Timings;
+
+    void Reset()
+    {
+        Pieces.Reset();
+        SectionMaterialIndices.Reset();
+        OriginalToProcVertexIndices.Reset();
+        OriginalToCutIndices.Reset();
+        ProcToOriginalVertexIndices.Reset();
+        Timings = FProcMeshCutStageTimings();
+    }
+};
+
+/**
+ * 절단 지오메트리 빌더. 버텍스 선택, 리맵, 탄젠트 재계산, 슬라이스, 스키닝 데이터 구성을
+ * FProcMeshCutSettings의 불변 사본만 읽어 수행하므로 워커 스레드에서 돌릴 수 있습니다.
+ * 출력 크기의 스크래치 배열은 인스턴스에 남아 다음 절단에서 재사용되고, LOD 크기의 임시 배열은 스레드별 FMemStack에서 잡습니다.
+ * 인스턴스 하나를 동시에 쓰면 안 됩니다.
+ */
+class FProcMeshCutBuilder
+{
+public:
+
+    // 절단되지 않은 버텍스/본의 절단 순번 (USkelToProcMeshComponent::NoCutIndex와 같은 값)
+    static constexpr uint8 NoCutIndex = 0xFF;
+
+    /**
+     * 스켈레톤 본 -> 소속 절단 테이블을 만듭니다. 절단 본 자신을 먼저 표시하고, 서브트리 모드면 부모 체인을 따라 아래 계층 전체로 전파합니다.
+     * 절단 본끼리 중첩되면(위팔 + 손) 가장 가까운 절단 조상이 본을 차지합니다.
+     * @param TargetBoneIndices 절단 본 (스켈레톤 본 인덱스, 순서가 CutIndex). INDEX_NONE은 무시
+     */
+    static void BuildBoneToCutTable(const FReferenceSkeleton& RefSkeleton, TConstArrayView<int32> TargetBoneIndices, bool bIncludeBoneSubtree, TArray<uint8>& OutBoneToCutIndices);
+
+    /**
+     * 절단 지오메트리를 만듭니다. OutResult는 내부에서 Reset되며 이전 할당을 재사용합니다.
+     * @return 조각이 하나라도 생겼으면 true
+     */
+    bool Build(const FProcMeshCutSettings& Settings, FProcMeshCutResult& OutResult);
+
+    /** 스크래치 메모리를 해제합니다. */
+    void Empty();
+
+private:
+
+    /**
+     * 버텍스 버퍼와 인덱스 버퍼를 각각 한 번만 훑어 절단별 지오메트리를 추출합니다.
+     * 버텍스마다 소속 본들의 가중치 합이 가장 큰 절단 하나에 배정합니다.
+     * 배정/카운트용 임시 배열은 호출 스레드의 FMemStack에서 잡고 반환 시 되돌립니다.
+     * @return 삼각형이 남은 절단이 하나라도 있으면 true
+     */
+    bool ExtractCuts(const FProcMeshCutSettings& Settings, FProcMeshCutResult& OutResult);
+
+    /** 슬라이스 전 지오메트리의 스키닝 데이터를 사본의 인플루언스에서 만듭니다. */
+    static void BuildSourceSkinningData(const FSkeletalMeshLODSourceData& SourceData, const FProcMeshGeometry& Geometry, TConstArrayView<int32> ProcToOriginalVertexIndices, FProcMeshSkinningBuffer& OutSkinningData);
+
+    FProcMeshSlicer Slicer;
+
+    // 절단별 슬라이스 전 지오메트리
+    TArray<FProcMeshGeometry> CutGeometries;
+
+    // 슬라이스 전 메시의 스키닝 데이터. 양쪽 절반은 슬라이스 출처를 따라 여기서 인플루언스를 물려받음
+    FProcMeshSkinningBuffer SourceSkinningData;
+
+    FProcMeshTangentBuilder TangentBuilder;
+
+    // 절단별 슬라이스 전 버텍스 중 버려진 삼각형에 걸친(면을 잃은) 버텍스. bRecalculateNormals일 때만 채워짐
+    TArray<TBitArray<>> CutBoundaryVertices;
+};
+
+/**
+ * 컴포넌트가 보관하는 절단 요청 하나. 비동기 절단 중에는 워커가 Builder/Result를 쓰고,
+ * 컴포넌트는 태스크가 끝날 때까지 이 객체를 건드리지 않습니다.
+ */
+struct FProcMeshCutRequest
+{
+    FProcMeshCutSettings Settings;
+    FProcMeshCutResult Result;
+    FProcMeshCutBuilder Builder;
+    bool bSucceeded = false;
+
+    // Result를 베이크된 에셋에서 채웠는지 (지오메트리 단계 생략)
+    bool bFromBakedData = false;
+
+    void Run()
+    {
+        bSucceeded = Builder.Build(Settings, Result);
+    }
+};
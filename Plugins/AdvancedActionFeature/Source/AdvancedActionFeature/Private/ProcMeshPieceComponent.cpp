@@ -0,0 +1,607 @@
+#include "ProcMeshPieceComponent.h"
+
+#include "AdvancedActionFeatureStats.h"
+#include "Containers/DynamicRHIResourceArray.h"
+#include "DynamicMeshBuilder.h"
+#include "Engine/Engine.h"
+#include "LocalVertexFactory.h"
+#include "MaterialDomain.h"
+#include "Materials/Material.h"
+#include "Materials/MaterialRenderProxy.h"
+#include "PrimitiveSceneProxy.h"
+#include "RenderingThread.h"
+#include "RenderResource.h"
+#include "SceneInterface.h"
+#include "SceneManagement.h"
+
+namespace
+{
+    /**
+     * 프록시 섹션의 정점 스트림 하나. 게임 스레드가 채운 초기 내용을 InitRHI에서 올리고 비웁니다.
+     * 스키닝 프레임이 매번 덮어쓰는 위치/탄젠트는 BUF_Dynamic으로, 섹션이 바뀌기 전까지 고정인 UV/컬러는 정적으로 만듭니다.
+     */
+    class FProcMeshPieceVertexBuffer final : public FVertexBuffer
+    {
+    public:
+
+        FProcMeshPieceVertexBuffer(uint32 InStride, EPixelFormat InSRVFormat, bool bInDynamic)
+            : Stride(InStride)
+            , SRVFormat(InSRVFormat)
+            , bDynamic(bInDynamic)
+        {
+        }
+
+        /** 정점 InNumVertices개의 초기 내용을 쓸 메모리를 반환합니다. BeginInitResource 전에 게임 스레드에서 호출 */
+        uint8* AllocateInitialData(uint32 InNumVertices)
+        {
+            NumVertices = InNumVertices;
+            InitialData.SetNumUninitialized(NumVertices * Stride);
+            return InitialData.GetData();
+        }
+
+        uint32 GetNumVertices() const { return NumVertices; }
+        FRHIShaderResourceView* GetSRV() const { return SRV; }
+
+        virtual void InitRHI(FRHICommandListBase& RHICmdList) override
+        {
+            const uint32 SizeInBytes = NumVertices * Stride;
+            if (SizeInBytes == 0)
+            {
+                return;
+            }
+
+            // 생성 시 리소스 배열 내용을 올리고 CPU 사본은 RHI가 버림
+            FRHIResourceCreateInfo CreateInfo(TEXT("ProcMeshPieceVertexBuffer"), &InitialData);
+            VertexBufferRHI = RHICmdList.CreateVertexBuffer(SizeInBytes, (bDynamic ? BUF_Dynamic : BUF_Static) | BUF_ShaderResource, CreateInfo);
+            InitialData.Empty();
+
+            // 수동 버텍스 페치 (FLocalVertexFactory가 SRV로 읽는 플랫폼)
+            SRV = RHICmdList.CreateShaderResourceView(VertexBufferRHI,
+                FRHIViewDesc::CreateBufferSRV().SetType(FRHIViewDesc::EBufferType::Typed).SetFormat(SRVFormat));
+        }
+
+        virtual void ReleaseRHI() override
+        {
+            SRV.SafeRelease();
+            FVertexBuffer::ReleaseRHI();
+        }
+
+        virtual FString GetFriendlyName() const override
+        {
+            return TEXT("FProcMeshPieceVertexBuffer");
+        }
+
+    private:
+
+        TResourceArray<uint8, VERTEXBUFFER_ALIGNMENT> InitialData;
+        FShaderResourceViewRHIRef SRV;
+        uint32 NumVertices = 0;
+        const uint32 Stride;
+        const EPixelFormat SRVFormat;
+        const bool bDynamic;
+    };
+
+    /** 프록시 섹션 하나. 정점 버퍼는 프록시 수명 동안 유지되고 스키닝 프레임이 위치/탄젠트 버퍼만 덮어씀 */
+    struct FProcMeshPieceProxySection
+    {
+        UMaterialInterface* Material = nullptr;
+        FProcMeshPieceVertexBuffer PositionBuffer { sizeof(FVector3f), PF_R32_FLOAT, true };
+        FProcMeshPieceVertexBuffer TangentBuffer { 2 * sizeof(FPackedNormal), PF_R8G8B8A8_SNORM, true }; // TangentX, TangentZ
+        FProcMeshPieceVertexBuffer TexCoordBuffer { sizeof(FVector2f), PF_G32R32F, false };
+        FProcMeshPieceVertexBuffer ColorBuffer { sizeof(FColor), PF_R8G8B8A8, false };
+        FDynamicMeshIndexBuffer32 IndexBuffer;
+        FLocalVertexFactory VertexFactory;
+        bool bSectionVisible = true;
+
+        explicit FProcMeshPieceProxySection(ERHIFeatureLevel::Type InFeatureLevel)
+            : VertexFactory(InFeatureLevel, "FProcMeshPieceProxySection")
+        {
+        }
+
+        /** 네 스트림을 버텍스 팩토리에 묶고 초기화합니다. 스트림 버퍼의 InitRHI 이후 렌더 스레드에서 호출 */
+        void InitVertexFactory_RenderThread(FRHICommandListBase& RHICmdList)
+        {
+            constexpr uint32 TangentStride = 2 * sizeof(FPackedNormal);
+
+            FLocalVertexFactory::FDataType Data;
+            Data.PositionComponent = FVertexStreamComponent(&PositionBuffer, 0, sizeof(FVector3f), VET_Float3);
+            Data.PositionComponentSRV = PositionBuffer.GetSRV();
+            Data.TangentBasisComponents[0] = FVertexStreamComponent(&TangentBuffer, 0, TangentStride, VET_PackedNormal, EVertexStreamUsage::ManualFetch);
+            Data.TangentBasisComponents[1] = FVertexStreamComponent(&TangentBuffer, sizeof(FPackedNormal), TangentStride, VET_PackedNormal, EVertexStreamUsage::ManualFetch);
+            Data.TangentsSRV = TangentBuffer.GetSRV();
+            Data.TextureCoordinates.Add(FVertexStreamComponent(&TexCoordBuffer, 0, sizeof(FVector2f), VET_Float2, EVertexStreamUsage::ManualFetch));
+            Data.TextureCoordinatesSRV = TexCoordBuffer.GetSRV();
+            Data.NumTexCoords = 1;
+            Data.LightMapCoordinateComponent = Data.TextureCoordinates[0];
+            Data.ColorComponent = FVertexStreamComponent(&ColorBuffer, 0, sizeof(FColor), VET_Color, EVertexStreamUsage::ManualFetch);
+            Data.ColorComponentsSRV = ColorBuffer.GetSRV();
+            Data.ColorIndexMask = ~0u;
+
+            VertexFactory.SetData(RHICmdList, Data);
+            VertexFactory.InitResource(RHICmdList);
+        }
+    };
+
+    class FProcMeshPieceSceneProxy final : public FPrimitiveSceneProxy
+    {
+    public:
+
+        explicit FProcMeshPieceSceneProxy(UProcMeshPieceComponent* Component)
+            : FPrimitiveSceneProxy(Component)
+            , MaterialRelevance(Component->GetMaterialRelevance(GetScene().GetFeatureLevel()))
+        {
+            const int32 NumSections = Component->GetNumSections();
+            Sections.SetNumZeroed(NumSections);
+
+            for (int32 SectionIdx = 0; SectionIdx < NumSections; ++SectionIdx)
+            {
+                const FProcMeshSection* SrcSection = Component->GetProcMeshSection(SectionIdx);
+                if (!SrcSection || SrcSection->ProcIndexBuffer.Num() == 0 || SrcSection->ProcVertexBuffer.Num() == 0)
+                {
+                    continue;
+                }
+
+                FProcMeshPieceProxySection* NewSection = new FProcMeshPieceProxySection(GetScene().GetFeatureLevel());
+
+                // 조각은 UV0만 쓰므로 텍스처 좌표 채널 1개
+                const int32 NumVertices = SrcSection->ProcVertexBuffer.Num();
+                FVector3f* Positions = reinterpret_cast<FVector3f*>(NewSection->PositionBuffer.AllocateInitialData(NumVertices));
+                FPackedNormal* Tangents = reinterpret_cast<FPackedNormal*>(NewSection->TangentBuffer.AllocateInitialData(NumVertices));
+                FVector2f* TexCoords = reinterpret_cast<FVector2f*>(NewSection->TexCoordBuffer.AllocateInitialData(NumVertices));
+                FColor* Colors = reinterpret_cast<FColor*>(NewSection->ColorBuffer.AllocateInitialData(NumVertices));
+                for (int32 VertexIdx = 0; VertexIdx < NumVertices; ++VertexIdx)
+                {
+                    const FProcMeshVertex& ProcVertex = SrcSection->ProcVertexBuffer[VertexIdx];
+                    Positions[VertexIdx] = FVector3f(ProcVertex.Position);
+                    Tangents[VertexIdx * 2 + 0] = FPackedNormal(FVector3f(ProcVertex.Tangent.TangentX));
+                    Tangents[VertexIdx * 2 + 1] = FPackedNormal(FVector3f(ProcVertex.Normal));
+                    Tangents[VertexIdx * 2 + 1].Vector.W = ProcVertex.Tangent.bFlipTangentY ? -127 : 127;
+                    TexCoords[VertexIdx] = FVector2f(ProcVertex.UV0);
+                    Colors[VertexIdx] = ProcVertex.Color;
+                }
+
+                NewSection->IndexBuffer.Indices = SrcSection->ProcIndexBuffer;
+
+                BeginInitResource(&NewSection->PositionBuffer);
+                BeginInitResource(&NewSection->TangentBuffer);
+                BeginInitResource(&NewSection->TexCoordBuffer);
+                BeginInitResource(&NewSection->ColorBuffer);
+                BeginInitResource(&NewSection->IndexBuffer);
+                ENQUEUE_RENDER_COMMAND(ProcMeshPieceInitVertexFactory)(
+                    [NewSection](FRHICommandListImmediate& RHICmdList)
+                    {
+                        NewSection->InitVertexFactory_RenderThread(RHICmdList);
+                    });
+
+                NewSection->Material = Component->GetMaterial(SectionIdx);
+                if (!NewSection->Material)
+                {
+                    NewSection->Material = UMaterial::GetDefaultMaterial(MD_Surface);
+                }
+                NewSection->bSectionVisible = SrcSection->bSectionVisible;
+                Sections[SectionIdx] = NewSection;
+            }
+        }
+
+        virtual ~FProcMeshPieceSceneProxy() override
+        {
+            for (FProcMeshPieceProxySection* Section : Sections)
+            {
+                if (Section)
+                {
+                    Section->PositionBuffer.ReleaseResource();
+                    Section->TangentBuffer.ReleaseResource();
+                    Section->TexCoordBuffer.ReleaseResource();
+                    Section->ColorBuffer.ReleaseResource();
+                    Section->IndexBuffer.ReleaseResource();
+                    Section->VertexFactory.ReleaseResource();
+                    delete Section;
+                }
+            }
+        }
+
+        /** 스키닝 프레임의 섹션 구간을 각 섹션의 동적 위치/탄젠트 버퍼에 그대로 복사합니다. UV/컬러/인덱스 버퍼는 건드리지 않음 */
+        void ApplySkinnedFrame_RenderThread(FRHICommandListImmediate& RHICmdList, const FProcMeshPieceSkinnedFrame& Frame)
+        {
+            SCOPE_CYCLE_COUNTER(STAT_ProcMeshSkinning_RenderUpdate);
+            TRACE_CPUPROFILER_EVENT_SCOPE(ProcMeshPiece::ApplySkinnedFrame);
+
+            const TArray<int32>& Offsets = Frame.SectionVertexOffsets;
+            for (int32 SectionIdx = 0; SectionIdx < Sections.Num() && SectionIdx + 1 < Offsets.Num(); ++SectionIdx)
+            {
+                FProcMeshPieceProxySection* Section = Sections[SectionIdx];
+                const int32 FirstVertex = Offsets[SectionIdx];
+                const int32 NumVertices = Offsets[SectionIdx + 1] - FirstVertex;
+                if (!Section || NumVertices == 0 || static_cast<uint32>(NumVertices) != Section->PositionBuffer.GetNumVertices())
+                {
+                    continue;
+                }
+
+                const uint32 PositionBytes = NumVertices * sizeof(FVector3f);
+                void* PositionData = RHICmdList.LockBuffer(Section->PositionBuffer.VertexBufferRHI, 0, PositionBytes, RLM_WriteOnly);
+                FMemory::Memcpy(PositionData, Frame.Positions.GetData() + FirstVertex, PositionBytes);
+                RHICmdList.UnlockBuffer(Section->PositionBuffer.VertexBufferRHI);
+
+                // 탄젠트 버퍼는 버텍스마다 FPackedNormal X/Z이므로 프레임 레이아웃과 같음
+                const uint32 TangentBytes = NumVertices * 2 * sizeof(FPackedNormal);
+                void* TangentData = RHICmdList.LockBuffer(Section->TangentBuffer.VertexBufferRHI, 0, TangentBytes, RLM_WriteOnly);
+                FMemory::Memcpy(TangentData, Frame.Tangents.GetData() + FirstVertex * 2, TangentBytes);
+                RHICmdList.UnlockBuffer(Section->TangentBuffer.VertexBufferRHI);
+            }
+        }
+
+        virtual void GetDynamicMeshElements(const TArray<const FSceneView*>& Views, const FSceneViewFamily& ViewFamily, uint32 VisibilityMap, FMeshElementCollector& Collector) const override
+        {
+            const bool bWireframe = AllowDebugViewmodes() && ViewFamily.EngineShowFlags.Wireframe;
+
+            FColoredMaterialRenderProxy* WireframeMaterialInstance = nullptr;
+            if (bWireframe)
+            {
+                WireframeMaterialInstance = new FColoredMaterialRenderProxy(
+                    GEngine->WireframeMaterial ? GEngine->WireframeMaterial->GetRenderProxy() : nullptr,
+                    FLinearColor(0, 0.5f, 1.f));
+                Collector.RegisterOneFrameMaterialProxy(WireframeMaterialInstance);
+            }
+
+            for (const FProcMeshPieceProxySection* Section : Sections)
+            {
+                if (!Section || !Section->bSectionVisible)
+                {
+                    continue;
+                }
+
+                FMaterialRenderProxy* MaterialProxy = bWireframe ? WireframeMaterialInstance : Section->Material->GetRenderProxy();
+                for (int32 ViewIndex = 0; ViewIndex < Views.Num(); ++ViewIndex)
+                {
+                    if (!(VisibilityMap & (1 << ViewIndex)))
+                    {
+                        continue;
+                    }
+
+                    FMeshBatch& Mesh = Collector.AllocateMesh();
+                    FMeshBatchElement& BatchElement = Mesh.Elements[0];
+                    BatchElement.IndexBuffer = &Section->IndexBuffer;
+                    Mesh.bWireframe = bWireframe;
+                    Mesh.VertexFactory = &Section->VertexFactory;
+                    Mesh.MaterialRenderProxy = MaterialProxy;
+
+                    bool bHasPrecomputedVolumetricLightmap;
+                    FMatrix PreviousLocalToWorld;
+                    int32 SingleCaptureIndex;
+                    bool bOutputVelocity;
+                    GetScene().GetPrimitiveUniformShaderParameters_RenderThread(GetPrimitiveSceneInfo(), bHasPrecomputedVolumetricLightmap, PreviousLocalToWorld, SingleCaptureIndex, bOutputVelocity);
+                    bOutputVelocity |= AlwaysHasVelocity();
+
+                    FDynamicPrimitiveUniformBuffer& DynamicPrimitiveUniformBuffer = Collector.AllocateOneFrameResource<FDynamicPrimitiveUniformBuffer>();
+                    DynamicPrimitiveUniformBuffer.Set(Collector.GetRHICommandList(), GetLocalToWorld(), PreviousLocalToWorld, GetBounds(), GetLocalBounds(), GetLocalBounds(),
+                                                      true, bHasPrecomputedVolumetricLightmap, bOutputVelocity, GetCustomPrimitiveData());
+                    BatchElement.PrimitiveUniformBufferResource = &DynamicPrimitiveUniformBuffer.UniformBuffer;
+                    BatchElement.PrimitiveIdMode = PrimID_DynamicPrimitiveShaderData;
+
+                    BatchElement.FirstIndex = 0;
+                    BatchElement.NumPrimitives = Section->IndexBuffer.Indices.Num() / 3;
+                    BatchElement.MinVertexIndex = 0;
+                    BatchElement.MaxVertexIndex = Section->PositionBuffer.GetNumVertices() - 1;
+                    Mesh.ReverseCulling = IsLocalToWorldDeterminantNegative();
+                    Mesh.Type = PT_TriangleList;
+                    Mesh.DepthPriorityGroup = SDPG_World;
+                    Mesh.bCanApplyViewModeOverrides = false;
+                    Collector.AddMesh(ViewIndex, Mesh);
+                }
+            }
+        }
+
+        virtual FPrimitiveViewRelevance GetViewRelevance(const FSceneView* View) const override
+        {
+            FPrimitiveViewRelevance Result;
+            Result.bDrawRelevance = IsShown(View);
+            Result.bShadowRelevance = IsShadowCast(View);
+            Result.bDynamicRelevance = true;
+            Result.bRenderInMainPass = ShouldRenderInMainPass();
+            Result.bUsesLightingChannels = GetLightingChannelMask() != GetDefaultLightingChannelMask();
+            Result.bRenderCustomDepth = ShouldRenderCustomDepth();
+            Result.bTranslucentSelfShadow = bCastVolumetricTranslucentShadow;
+            MaterialRelevance.SetPrimitiveViewRelevance(Result);
+            Result.bVelocityRelevance = DrawsVelocity() && Result.bOpaque && Result.bRenderInMainPass;
+            return Result;
+        }
+
+        virtual bool CanBeOccluded() const override
+        {
+            return !MaterialRelevance.bDisableDepthTest;
+        }
+
+        virtual uint32 GetMemoryFootprint() const override
+        {
+            return sizeof(*this) + GetAllocatedSize();
+        }
+
+        virtual SIZE_T GetTypeHash() const override
+        {
+            static size_t UniquePointer;
+            return reinterpret_cast<size_t>(&UniquePointer);
+        }
+
+    private:
+
+        TArray<FProcMeshPieceProxySection*> Sections;
+        FMaterialRelevance MaterialRelevance;
+    };
+
+    /** 프레임을 렌더 스레드로 넘깁니다. 명령은 프록시 해제 명령보다 먼저 실행되므로 프록시 포인터를 그대로 넘김 */
+    void EnqueueSkinnedFrame(FProcMeshPieceSceneProxy* Proxy, const TSharedRef<FProcMeshPieceSkinnedFrame, ESPMode::ThreadSafe>& Frame)
+    {
+        Frame->NumPendingReads.fetch_add(1, std::memory_order_relaxed);
+        ENQUEUE_RENDER_COMMAND(ProcMeshPieceSkinnedFrame)(
+            [Proxy, Frame](FRHICommandListImmediate& RHICmdList)
+            {
+                Proxy->ApplySkinnedFrame_RenderThread(RHICmdList, *Frame);
+                Frame->NumPendingReads.fetch_sub(1, std::memory_order_release);
+            });
+    }
+}
+
+UProcMeshPieceComponent::UProcMeshPieceComponent(const FObjectInitializer& ObjectInitializer)
+    : Super(ObjectInitializer)
+{
+}
+
+FPrimitiveSceneProxy* UProcMeshPieceComponent::CreateSceneProxy()
+{
+    if (GetNumSections() == 0)
+    {
+        return nullptr;
+    }
+
+    FProcMeshPieceSceneProxy* Proxy = new FProcMeshPieceSceneProxy(this);
+
+    // 섹션 데이터는 바인드 포즈이므로, 스키닝 중에 프록시가 다시 만들어지면 마지막 프레임을 바로 덮어씀
+    if (LastSubmittedFrame != INDEX_NONE)
+    {
+        EnqueueSkinnedFrame(Proxy, SkinnedFrames[LastSubmittedFrame]);
+    }
+    return Proxy;
+}
+
+int32 UProcMeshPieceComponent::GetNumMaterials() const
+{
+    return NumSections;
+}
+
+FBoxSphereBounds UProcMeshPieceComponent::CalcBounds(const FTransform& LocalToWorld) const
+{
+    if (bHasSkinnedBounds)
+    {
+        return FBoxSphereBounds(FBox(SkinnedLocalBox)).TransformBy(LocalToWorld);
+    }
+    return LocalBounds.TransformBy(LocalToWorld);
+}
+
+void UProcMeshPieceComponent::CreateMeshSection_LinearColor(int32 SectionIndex, const TArray<FVector>& Vertices, const TArray<int32>& Triangles, const TArray<FVector>& Normals,
+                                                            const TArray<FVector2D>& UV0, const TArray<FLinearColor>& VertexColors, const TArray<FProcMeshTangent>& Tangents)
+{
+    if (SectionIndex < 0)
+    {
+        return;
+    }
+    if (SectionIndex >= ProcMeshSections.Num())
+    {
+        ProcMeshSections.SetNum(SectionIndex + 1);
+    }
+    NumSections = FMath::Max(NumSections, SectionIndex + 1);
+
+    // 이전 조각이 쓰던 버퍼 용량을 그대로 재사용
+    FProcMeshSection& Section = ProcMeshSections[SectionIndex];
+    ResetSection(Section);
+
+    const int32 NumVertices = Vertices.Num();
+    Section.ProcVertexBuffer.SetNum(NumVertices, EAllowShrinking::No);
+    for (int32 VertexIdx = 0; VertexIdx < NumVertices; ++VertexIdx)
+    {
+        FProcMeshVertex& Vertex = Section.ProcVertexBuffer[VertexIdx];
+        Vertex.Position = Vertices[VertexIdx];
+        Vertex.Normal = Normals.Num() == NumVertices ? Normals[VertexIdx] : FVector::UpVector;
+        Vertex.UV0 = UV0.Num() == NumVertices ? UV0[VertexIdx] : FVector2D::ZeroVector;
+        Vertex.Color = VertexColors.Num() == NumVertices ? VertexColors[VertexIdx].ToFColor(false) : FColor::White;
+        Vertex.Tangent = Tangents.Num() == NumVertices ? Tangents[VertexIdx] : FProcMeshTangent();
+        Section.SectionLocalBox += Vertex.Position;
+    }
+
+    // 완전한 삼각형만, 범위를 벗어난 인덱스는 마지막 버텍스로 고정 (엔진 구현과 같음)
+    const int32 NumTriIndices = (Triangles.Num() / 3) * 3;
+    Section.ProcIndexBuffer.SetNumUninitialized(NumTriIndices, EAllowShrinking::No);
+    for (int32 IndexIdx = 0; IndexIdx < NumTriIndices; ++IndexIdx)
+    {
+        Section.ProcIndexBuffer[IndexIdx] = static_cast<uint32>(FMath::Min(Triangles[IndexIdx], NumVertices - 1));
+    }
+    Section.bEnableCollision = false;
+
+    UpdateLocalBounds();
+    MarkRenderStateDirty();
+}
+
+void UProcMeshPieceComponent::ClearAllMeshSections()
+{
+    for (int32 SectionIdx = 0; SectionIdx < NumSections; ++SectionIdx)
+    {
+        ResetSection(ProcMeshSections[SectionIdx]);
+    }
+    NumSections = 0;
+    UpdateLocalBounds();
+    MarkRenderStateDirty();
+}
+
+void UProcMeshPieceComponent::ResetSection(FProcMeshSection& Section)
+{
+    Section.ProcVertexBuffer.SetNum(0, EAllowShrinking::No);
+    Section.ProcIndexBuffer.SetNum(0, EAllowShrinking::No);
+    Section.SectionLocalBox.Init();
+    Section.bEnableCollision = false;
+    Section.bSectionVisible = true;
+}
+
+const FProcMeshSection* UProcMeshPieceComponent::GetProcMeshSection(int32 SectionIndex) const
+{
+    return SectionIndex >= 0 && SectionIndex < NumSections ? &ProcMeshSections[SectionIndex] : nullptr;
+}
+
+void UProcMeshPieceComponent::SetProcMeshSection(int32 SectionIndex, const FProcMeshSection& Section)
+{
+    if (SectionIndex < 0)
+    {
+        return;
+    }
+    if (SectionIndex >= ProcMeshSections.Num())
+    {
+        ProcMeshSections.SetNum(SectionIndex + 1);
+    }
+    NumSections = FMath::Max(NumSections, SectionIndex + 1);
+
+    // 대입 연산은 크기에 맞춰 다시 할당하므로 기존 용량에 복사
+    FProcMeshSection& DestSection = ProcMeshSections[SectionIndex];
+    ResetSection(DestSection);
+    DestSection.ProcVertexBuffer.Append(Section.ProcVertexBuffer);
+    DestSection.ProcIndexBuffer.Append(Section.ProcIndexBuffer);
+    DestSection.SectionLocalBox = Section.SectionLocalBox;
+    DestSection.bEnableCollision = Section.bEnableCollision;
+    DestSection.bSectionVisible = Section.bSectionVisible;
+
+    UpdateLocalBounds();
+    MarkRenderStateDirty();
+}
+
+void UProcMeshPieceComponent::UpdateLocalBounds()
+{
+    FBox LocalBox(ForceInit);
+    for (int32 SectionIdx = 0; SectionIdx < NumSections; ++SectionIdx)
+    {
+        LocalBox += ProcMeshSections[SectionIdx].SectionLocalBox;
+    }
+    LocalBounds = LocalBox.IsValid ? FBoxSphereBounds(LocalBox) : FBoxSphereBounds(FVector::ZeroVector, FVector::ZeroVector, 0);
+
+    UpdateBounds();
+    MarkRenderTransformDirty();
+}
+
+FProcMeshPieceSkinnedFrame* UProcMeshPieceComponent::BeginSkinnedFrame(int32 NumVertices, bool bWaitForFreeSlot)
+{
+    if (SkinnedFrames.Num() == 0)
+    {
+        for (int32 FrameIdx = 0; FrameIdx < NumSkinnedFrames; ++FrameIdx)
+        {
+            SkinnedFrames.Add(MakeShared<FProcMeshPieceSkinnedFrame, ESPMode::ThreadSafe>());
+        }
+    }
+
+    FProcMeshPieceSkinnedFrame* Frame = FindFreeSkinnedFrame();
+    if (!Frame && bWaitForFreeSlot)
+    {
+        // 대기 중인 명령이 모두 실행되면 마지막 제출 슬롯 외의 슬롯은 모두 비어 있음
+        TRACE_CPUPROFILER_EVENT_SCOPE(ProcMeshPiece::WaitForSkinnedFrame);
+        FlushRenderingCommands();
+        Frame = FindFreeSkinnedFrame();
+    }
+    if (!Frame)
+    {
+        return nullptr;
+    }
+
+    Frame->Positions.SetNumUninitialized(NumVertices, EAllowShrinking::No);
+    Frame->Tangents.SetNumUninitialized(NumVertices * 2, EAllowShrinking::No);
+    return Frame;
+}
+
+FProcMeshPieceSkinnedFrame* UProcMeshPieceComponent::FindFreeSkinnedFrame()
+{
+    // 렌더 스레드가 아직 읽는 슬롯은 건너뛰고, 마지막 제출 슬롯은 새 프록시 초기화용으로 남김
+    for (int32 Attempt = 0; Attempt < SkinnedFrames.Num(); ++Attempt)
+    {
+        const int32 FrameIdx = (NextSkinnedFrame + Attempt) % SkinnedFrames.Num();
+        FProcMeshPieceSkinnedFrame& Frame = SkinnedFrames[FrameIdx].Get();
+        if (FrameIdx == LastSubmittedFrame || Frame.NumPendingReads.load(std::memory_order_acquire) != 0)
+        {
+            continue;
+        }
+
+        NextSkinnedFrame = FrameIdx;
+        return &Frame;
+    }
+    return nullptr;
+}
+
+void UProcMeshPieceComponent::SubmitSkinnedFrame(FProcMeshPieceSkinnedFrame* Frame, TConstArrayView<int32> SectionVertexOffsets)
+{
+    check(Frame && SkinnedFrames.IsValidIndex(NextSkinnedFrame) && Frame == &SkinnedFrames[NextSkinnedFrame].Get());
+
+    Frame->SectionVertexOffsets.Reset(SectionVertexOffsets.Num());
+    Frame->SectionVertexOffsets.Append(SectionVertexOffsets.GetData(), SectionVertexOffsets.Num());
+    SkinnedLocalBox = FBox3f(Frame->Positions.GetData(), Frame->Positions.Num());
+    bHasSkinnedBounds = SkinnedLocalBox.IsValid != 0;
+
+    LastSubmittedFrame = NextSkinnedFrame;
+    NextSkinnedFrame = (NextSkinnedFrame + 1) % SkinnedFrames.Num();
+
+    // 프록시가 없거나 곧 다시 만들어지면 CreateSceneProxy가 마지막 프레임을 적용
+    if (SceneProxy && !IsRenderStateDirty())
+    {
+        EnqueueSkinnedFrame(static_cast<FProcMeshPieceSceneProxy*>(SceneProxy), SkinnedFrames[LastSubmittedFrame]);
+    }
+
+    // 바운드만 갱신 (프록시 재생성 없이 트랜스폼/바운드만 보냄)
+    UpdateBounds();
+    MarkRenderTransformDirty();
+}
+
+const FProcMeshPieceSkinnedFrame* UProcMeshPieceComponent::GetLastSubmittedFrame() const
+{
+    return LastSubmittedFrame != INDEX_NONE ? &SkinnedFrames[LastSubmittedFrame].Get() : nullptr;
+}
+
+void UProcMeshPieceComponent::BakeSkinnedFrame()
+{
+    if (const FProcMeshPieceSkinnedFrame* Frame = GetLastSubmittedFrame())
+    {
+        // 섹션 버퍼를 복사하지 않고 제자리에서 덮어씀
+        const TArray<int32>& Offsets = Frame->SectionVertexOffsets;
+        for (int32 SectionIdx = 0; SectionIdx < NumSections && SectionIdx + 1 < Offsets.Num(); ++SectionIdx)
+        {
+            FProcMeshSection& Section = ProcMeshSections[SectionIdx];
+            const int32 FirstVertex = Offsets[SectionIdx];
+            if (Section.ProcVertexBuffer.Num() != Offsets[SectionIdx + 1] - FirstVertex || Section.ProcVertexBuffer.Num() == 0)
+            {
+                continue;
+            }
+
+            Section.SectionLocalBox.Init();
+            for (int32 VertexIdx = 0; VertexIdx < Section.ProcVertexBuffer.Num(); ++VertexIdx)
+            {
+                FProcMeshVertex& Vertex = Section.ProcVertexBuffer[VertexIdx];
+                const FPackedNormal& TangentX = Frame->Tangents[(FirstVertex + VertexIdx) * 2 + 0];
+                const FPackedNormal& TangentZ = Frame->Tangents[(FirstVertex + VertexIdx) * 2 + 1];
+                Vertex.Position = FVector(Frame->Positions[FirstVertex + VertexIdx]);
+                Vertex.Normal = FVector(TangentZ.ToFVector3f());
+                Vertex.Tangent = FProcMeshTangent(FVector(TangentX.ToFVector3f()), TangentZ.Vector.W < 0);
+                Section.SectionLocalBox += Vertex.Position;
+            }
+        }
+
+        // 렌더 상태를 다시 만들어 새 프록시가 구운 데이터로 생성되게 함
+        UpdateLocalBounds();
+        MarkRenderStateDirty();
+    }
+
+    ResetSkinnedFrames();
+}
+
+void UProcMeshPieceComponent::ResetSkinnedFrames()
+{
+    // 렌더 명령이 들고 있는 슬롯은 공유 참조라 명령이 끝날 때 해제됨
+    SkinnedFrames.Empty();
+    NextSkinnedFrame = 0;
+    LastSubmittedFrame = INDEX_NONE;
+    if (bHasSkinnedBounds)
+    {
+        bHasSkinnedBounds = false;
+        UpdateBounds();
+    }
+}
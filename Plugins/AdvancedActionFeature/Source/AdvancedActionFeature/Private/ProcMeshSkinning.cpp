@@ -0,0 +1,464 @@
+#include "ProcMeshSkinning.h"
+
+#include "AdvancedActionFeature.h"
+#include "AdvancedActionFeatureStats.h"
+#include "Algo/Sort.h"
+#include "Async/ParallelFor.h"
+#include "GPUSkinPublicDefs.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/MemStack.h"
+
+static TAutoConsoleVariable<bool> CVarSkinningUseSimd(
+    TEXT("AdvancedAction.Skinning.UseSimd"),
+    true,
+    TEXT("프로시저럴 조각 스키닝에 SIMD 커널을 사용합니다. false이면 스칼라 레퍼런스 커널을 사용합니다."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarSkinningChunkSize(
+    TEXT("AdvancedAction.Skinning.ChunkSize"),
+    1024,
+    TEXT("병렬 스키닝 시 워커 하나가 처리하는 버텍스 수. 0 이하이면 병렬화하지 않습니다."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<bool> CVarSkinningValidateSimd(
+    TEXT("AdvancedAction.Skinning.ValidateSimd"),
+    false,
+    TEXT("SIMD 커널 결과를 스칼라 커널과 비교해 허용 오차를 넘으면 경고를 남깁니다. (디버그용, 비용 큼)"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarSkinningValidateTolerance(
+    TEXT("AdvancedAction.Skinning.ValidateTolerance"),
+    0.01f,
+    TEXT("AdvancedAction.Skinning.ValidateSimd 비교 시 허용하는 최대 위치 오차 (cm)."),
+    ECVF_Default);
+
+void FProcMeshSkinningBuffer::Init(int32 NumVertices, int32 SourceMaxInfluences)
+{
+    // 4개 이하는 4슬롯, 그 이상은 8슬롯으로 고정 (8개 초과분은 SetVertexInfluences에서 잘라냄)
+    InfluencesPerVertex = SourceMaxInfluences <= 4 ? 4 : 8;
+
+    const int32 NumSlots = NumVertices * InfluencesPerVertex;
+    BoneIndices.Empty(NumSlots);
+    BoneIndices.SetNumZeroed(NumSlots);
+    BoneWeights.Empty(NumSlots);
+    BoneWeights.SetNumZeroed(NumSlots);
+    PaletteBones.Reset();
+
+    BindPositions.Empty(NumVertices);
+    BindPositions.SetNumZeroed(NumVertices);
+    BindTangentFrames.Empty(NumVertices * 2);
+    BindTangentFrames.SetNumZeroed(NumVertices * 2);
+}
+
+void FProcMeshSkinningBuffer::Reset()
+{
+    InfluencesPerVertex = 0;
+    BoneIndices.Empty();
+    BoneWeights.Empty();
+    PaletteBones.Empty();
+    BindPositions.Empty();
+    BindTangentFrames.Empty();
+}
+
+void FProcMeshSkinningBuffer::SetBindTangentFrame(int32 VertexIndex, const FVector3f& TangentX, const FVector3f& TangentZ, bool bFlipTangentY)
+{
+    // 프로시저럴 메시 프록시와 같은 규약: 바이노멀 부호는 TangentZ.W
+    BindTangentFrames[VertexIndex * 2 + 0] = FPackedNormal(TangentX).Vector.Packed;
+    BindTangentFrames[VertexIndex * 2 + 1] = FPackedNormal(FVector4f(TangentZ, bFlipTangentY ? -1.0f : 1.0f)).Vector.Packed;
+}
+
+bool FProcMeshSkinningBuffer::SetVertexInfluences(int32 VertexIndex, const uint16* SkeletonBoneIndices, const float* Weights, int32 NumInfluences)
+{
+    check(InfluencesPerVertex > 0 && VertexIndex >= 0 && VertexIndex < Num());
+
+    // 가중치 내림차순으로 정렬해 상위 슬롯만 남김 (출처 두 개를 병합한 경우까지 수용)
+    constexpr int32 MaxInputInfluences = MAX_TOTAL_INFLUENCES * 2;
+    int32 Order[MaxInputInfluences];
+    int32 NumValid = 0;
+    for (int32 InfluenceIdx = 0; InfluenceIdx < NumInfluences && NumValid < MaxInputInfluences; ++InfluenceIdx)
+    {
+        if (Weights[InfluenceIdx] > 0.f)
+        {
+            Order[NumValid++] = InfluenceIdx;
+        }
+    }
+    if (NumValid == 0)
+    {
+        return false;
+    }
+
+    Algo::Sort(MakeArrayView(Order, NumValid), [Weights](int32 A, int32 B) { return Weights[A] > Weights[B]; });
+    const int32 NumKept = FMath::Min(NumValid, InfluencesPerVertex);
+
+    float TotalWeight = 0.f;
+    for (int32 SlotIdx = 0; SlotIdx < NumKept; ++SlotIdx)
+    {
+        TotalWeight += Weights[Order[SlotIdx]];
+    }
+
+    uint16* SlotBones = BoneIndices.GetData() + VertexIndex * InfluencesPerVertex;
+    uint16* SlotWeights = BoneWeights.GetData() + VertexIndex * InfluencesPerVertex;
+
+    // 반올림 오차는 가장 큰 가중치 슬롯(0번)에 몰아서 합계를 정확히 맞춤
+    int32 QuantizedTotal = 0;
+    for (int32 SlotIdx = 0; SlotIdx < InfluencesPerVertex; ++SlotIdx)
+    {
+        if (SlotIdx < NumKept)
+        {
+            const uint16 Quantized = static_cast<uint16>(FMath::RoundToInt(Weights[Order[SlotIdx]] / TotalWeight * MaxQuantizedWeight));
+            SlotBones[SlotIdx] = SkeletonBoneIndices[Order[SlotIdx]];
+            SlotWeights[SlotIdx] = Quantized;
+            QuantizedTotal += Quantized;
+        }
+        else
+        {
+            SlotBones[SlotIdx] = 0;
+            SlotWeights[SlotIdx] = 0;
+        }
+    }
+    SlotWeights[0] = static_cast<uint16>(SlotWeights[0] + (MaxQuantizedWeight - QuantizedTotal));
+
+    return true;
+}
+
+void FProcMeshSkinningBuffer::CompactBonePalette()
+{
+    PaletteBones.Reset();
+
+    // 스켈레톤 본 인덱스 -> 팔레트 인덱스. 본 수는 uint16 범위이므로 작은 임시 맵으로 충분
+    TMap<uint16, uint16> SkeletonToPalette;
+    for (int32 SlotIdx = 0; SlotIdx < BoneIndices.Num(); ++SlotIdx)
+    {
+        if (BoneWeights[SlotIdx] == 0)
+        {
+            BoneIndices[SlotIdx] = 0;
+            continue;
+        }
+
+        const uint16 SkeletonBoneIndex = BoneIndices[SlotIdx];
+        uint16* PaletteIndex = SkeletonToPalette.Find(SkeletonBoneIndex);
+        if (!PaletteIndex)
+        {
+            PaletteIndex = &SkeletonToPalette.Add(SkeletonBoneIndex, static_cast<uint16>(PaletteBones.Add(SkeletonBoneIndex)));
+        }
+        BoneIndices[SlotIdx] = *PaletteIndex;
+    }
+
+    // 가중치가 전혀 없는 조각도 커널이 0번 팔레트를 안전하게 읽을 수 있도록 최소 한 개 유지
+    if (PaletteBones.Num() == 0 && Num() > 0)
+    {
+        PaletteBones.Add(0);
+    }
+}
+
+void FProcMeshSkinningBuffer::InitFromProvenance(const FProcMeshSkinningBuffer& Source, TConstArrayView<FProcMeshVertexProvenance> Provenance)
+{
+    const int32 NumVertices = Provenance.Num();
+    Init(NumVertices, Source.InfluencesPerVertex);
+    if (Source.IsEmpty())
+    {
+        return;
+    }
+
+    const int32 SourceStride = Source.InfluencesPerVertex;
+    for (int32 VertexIdx = 0; VertexIdx < NumVertices; ++VertexIdx)
+    {
+        // 두 출처의 슬롯을 스켈레톤 본 인덱스 기준으로 병합
+        uint16 SkeletonBones[MAX_TOTAL_INFLUENCES * 2];
+        float Weights[MAX_TOTAL_INFLUENCES * 2];
+        int32 NumInfluences = 0;
+
+        auto Accumulate = [&](int32 SourceVertex, float Scale)
+        {
+            if (SourceVertex < 0 || SourceVertex >= Source.Num() || Scale <= 0.f) return;
+
+            for (int32 SlotIdx = 0; SlotIdx < SourceStride; ++SlotIdx)
+            {
+                const uint16 QuantizedWeight = Source.BoneWeights[SourceVertex * SourceStride + SlotIdx];
+                if (QuantizedWeight == 0) continue;
+
+                const uint16 SkeletonBone = Source.PaletteBones[Source.BoneIndices[SourceVertex * SourceStride + SlotIdx]];
+                const float Weight = QuantizedWeight * Scale;
+
+                int32 Existing = 0;
+                while (Existing < NumInfluences && SkeletonBones[Existing] != SkeletonBone) ++Existing;
+                if (Existing < NumInfluences)
+                {
+                    Weights[Existing] += Weight;
+                }
+                else
+                {
+                    SkeletonBones[NumInfluences] = SkeletonBone;
+                    Weights[NumInfluences] = Weight;
+                    ++NumInfluences;
+                }
+            }
+        };
+
+        const FProcMeshVertexProvenance& Origin = Provenance[VertexIdx];
+        if (Origin.IsInterpolated())
+        {
+            Accumulate(Origin.SourceA, 1.f - Origin.Alpha);
+            Accumulate(Origin.SourceB, Origin.Alpha);
+        }
+        else
+        {
+            Accumulate(Origin.SourceA, 1.f);
+        }
+
+        SetVertexInfluences(VertexIdx, SkeletonBones, Weights, NumInfluences);
+    }
+
+    CompactBonePalette();
+}
+
+void FProcMeshSkinningBuffer::InitFromRemap(const FProcMeshSkinningBuffer& Source, TConstArrayView<int32> SourceVertexIndices)
+{
+    if (Source.IsEmpty())
+    {
+        Reset();
+        return;
+    }
+
+    const int32 NumVertices = SourceVertexIndices.Num();
+    Init(NumVertices, Source.InfluencesPerVertex);
+    PaletteBones = Source.PaletteBones;
+
+    const int32 Stride = InfluencesPerVertex;
+    for (int32 VertexIdx = 0; VertexIdx < NumVertices; ++VertexIdx)
+    {
+        const int32 SourceVertex = SourceVertexIndices[VertexIdx];
+        check(SourceVertex >= 0 && SourceVertex < Source.Num());
+
+        FMemory::Memcpy(&BoneIndices[VertexIdx * Stride], &Source.BoneIndices[SourceVertex * Stride], Stride * sizeof(uint16));
+        FMemory::Memcpy(&BoneWeights[VertexIdx * Stride], &Source.BoneWeights[SourceVertex * Stride], Stride * sizeof(uint16));
+        BindPositions[VertexIdx] = Source.BindPositions[SourceVertex];
+        BindTangentFrames[VertexIdx * 2 + 0] = Source.BindTangentFrames[SourceVertex * 2 + 0];
+        BindTangentFrames[VertexIdx * 2 + 1] = Source.BindTangentFrames[SourceVertex * 2 + 1];
+    }
+}
+
+void FProcMeshSkinningBuffer::BuildSkinningPalette(const TArray<FMatrix44f>& RefBasesInvMatrix, const TArray<FTransform>& ComponentSpaceTransforms, TArray<FMatrix44f>& OutPalette) const
+{
+    OutPalette.SetNumUninitialized(PaletteBones.Num(), EAllowShrinking::No);
+    for (int32 PaletteIdx = 0; PaletteIdx < PaletteBones.Num(); ++PaletteIdx)
+    {
+        const int32 BoneIndex = PaletteBones[PaletteIdx];
+        if (RefBasesInvMatrix.IsValidIndex(BoneIndex) && ComponentSpaceTransforms.IsValidIndex(BoneIndex))
+        {
+            // 최종 스키닝 매트릭스 (바인드 포즈 컴포넌트 공간 -> 현재 컴포넌트 공간)
+            OutPalette[PaletteIdx] = RefBasesInvMatrix[BoneIndex] * FMatrix44f(ComponentSpaceTransforms[BoneIndex].ToMatrixWithScale());
+        }
+        else
+        {
+            OutPalette[PaletteIdx] = FMatrix44f::Identity;
+        }
+    }
+}
+
+SIZE_T FProcMeshSkinningBuffer::GetAllocatedSize() const
+{
+    return BoneIndices.GetAllocatedSize()
+        + BoneWeights.GetAllocatedSize()
+        + PaletteBones.GetAllocatedSize()
+        + BindPositions.GetAllocatedSize()
+        + BindTangentFrames.GetAllocatedSize();
+}
+
+namespace
+{
+    /** 블렌딩된 행렬의 회전/스케일 부분(Row0~2)으로 방향을 변환해 정규화합니다. 길이가 0이면 원래 방향 유지 */
+    FORCEINLINE VectorRegister4Float TransformDirectionBlended(const VectorRegister4Float& Direction, const VectorRegister4Float& Row0, const VectorRegister4Float& Row1, const VectorRegister4Float& Row2)
+    {
+        VectorRegister4Float Transformed = VectorMultiply(VectorReplicate(Direction, 2), Row2);
+        Transformed = VectorMultiplyAdd(VectorReplicate(Direction, 1), Row1, Transformed);
+        Transformed = VectorMultiplyAdd(VectorReplicate(Direction, 0), Row0, Transformed);
+        return VectorNormalizeSafe(VectorSet_W0(Transformed), Direction);
+    }
+
+    /** 스키닝된 TangentZ를 패킹하고 바인드 포즈의 바이노멀 부호를 옮겨 씁니다. */
+    FORCEINLINE FPackedNormal PackTangentZ(const FVector4f& SkinnedNormal, const FPackedNormal& BindTangentZ)
+    {
+        FPackedNormal Packed(SkinnedNormal);
+        Packed.Vector.W = BindTangentZ.Vector.W;
+        return Packed;
+    }
+}
+
+namespace ProcMeshSkinning
+{
+    void SkinVerticesScalar(const FProcMeshSkinningBuffer& Buffer, const FMatrix44f* Palette, int32 StartVertex, int32 NumVertices, FVector3f* OutPositions, FPackedNormal* OutTangents)
+    {
+        const int32 InfluencesPerVertex = Buffer.InfluencesPerVertex;
+        const float WeightScale = 1.0f / FProcMeshSkinningBuffer::MaxQuantizedWeight;
+        const uint16* BoneIndices = Buffer.BoneIndices.GetData();
+        const uint16* BoneWeights = Buffer.BoneWeights.GetData();
+
+        for (int32 VertexIdx = StartVertex; VertexIdx < StartVertex + NumVertices; ++VertexIdx)
+        {
+            const FVector3f& BindPosition = Buffer.BindPositions[VertexIdx];
+            const FVector3f BindTangentX = Buffer.GetBindTangentX(VertexIdx).ToFVector3f();
+            const FPackedNormal BindTangentZ = Buffer.GetBindTangentZ(VertexIdx);
+            const FVector3f BindNormal = BindTangentZ.ToFVector3f();
+            FVector3f SkinnedPosition = FVector3f::ZeroVector;
+            FVector3f SkinnedTangentX = FVector3f::ZeroVector;
+            FVector3f SkinnedNormal = FVector3f::ZeroVector;
+
+            const int32 SlotBase = VertexIdx * InfluencesPerVertex;
+            for (int32 SlotIdx = 0; SlotIdx < InfluencesPerVertex; ++SlotIdx)
+            {
+                const uint16 QuantizedWeight = BoneWeights[SlotBase + SlotIdx];
+                if (QuantizedWeight == 0) continue;
+
+                const float BoneWeight = QuantizedWeight * WeightScale;
+                const FMatrix44f& SkinMatrix = Palette[BoneIndices[SlotBase + SlotIdx]];
+                SkinnedPosition += FVector3f(SkinMatrix.TransformPosition(BindPosition)) * BoneWeight;
+                SkinnedTangentX += FVector3f(SkinMatrix.TransformVector(BindTangentX)) * BoneWeight;
+                SkinnedNormal += FVector3f(SkinMatrix.TransformVector(BindNormal)) * BoneWeight;
+            }
+            const int32 OutIdx = VertexIdx - StartVertex;
+            OutPositions[OutIdx] = SkinnedPosition;
+            OutTangents[OutIdx * 2 + 0] = FPackedNormal(SkinnedTangentX.GetSafeNormal(UE_SMALL_NUMBER, BindTangentX));
+            OutTangents[OutIdx * 2 + 1] = PackTangentZ(FVector4f(SkinnedNormal.GetSafeNormal(UE_SMALL_NUMBER, BindNormal), 0.0f), BindTangentZ);
+        }
+    }
+
+    void SkinVerticesSimd(const FProcMeshSkinningBuffer& Buffer, const FMatrix44f* Palette, int32 StartVertex, int32 NumVertices, FVector3f* OutPositions, FPackedNormal* OutTangents)
+    {
+        const int32 InfluencesPerVertex = Buffer.InfluencesPerVertex;
+        const float WeightScale = 1.0f / FProcMeshSkinningBuffer::MaxQuantizedWeight;
+        const uint16* BoneIndices = Buffer.BoneIndices.GetData();
+        const uint16* BoneWeights = Buffer.BoneWeights.GetData();
+        const FVector3f* BindPositions = Buffer.BindPositions.GetData();
+
+        for (int32 VertexIdx = StartVertex; VertexIdx < StartVertex + NumVertices; ++VertexIdx)
+        {
+            const uint16* SlotBones = BoneIndices + VertexIdx * InfluencesPerVertex;
+            const uint16* SlotWeights = BoneWeights + VertexIdx * InfluencesPerVertex;
+
+            // 슬롯은 가중치 내림차순으로 정렬되어 있으므로 0번 슬롯으로 초기화하고 0 가중치에서 중단
+            const VectorRegister4Float Weight0 = VectorSetFloat1(SlotWeights[0] * WeightScale);
+            const FMatrix44f& Matrix0 = Palette[SlotBones[0]];
+            VectorRegister4Float Row0 = VectorMultiply(VectorLoadAligned(Matrix0.M[0]), Weight0);
+            VectorRegister4Float Row1 = VectorMultiply(VectorLoadAligned(Matrix0.M[1]), Weight0);
+            VectorRegister4Float Row2 = VectorMultiply(VectorLoadAligned(Matrix0.M[2]), Weight0);
+            VectorRegister4Float Row3 = VectorMultiply(VectorLoadAligned(Matrix0.M[3]), Weight0);
+
+            for (int32 SlotIdx = 1; SlotIdx < InfluencesPerVertex && SlotWeights[SlotIdx] != 0; ++SlotIdx)
+            {
+                const VectorRegister4Float Weight = VectorSetFloat1(SlotWeights[SlotIdx] * WeightScale);
+                const FMatrix44f& Matrix = Palette[SlotBones[SlotIdx]];
+                Row0 = VectorMultiplyAdd(VectorLoadAligned(Matrix.M[0]), Weight, Row0);
+                Row1 = VectorMultiplyAdd(VectorLoadAligned(Matrix.M[1]), Weight, Row1);
+                Row2 = VectorMultiplyAdd(VectorLoadAligned(Matrix.M[2]), Weight, Row2);
+                Row3 = VectorMultiplyAdd(VectorLoadAligned(Matrix.M[3]), Weight, Row3);
+            }
+
+            // 행 벡터 규약: P' = P.X * Row0 + P.Y * Row1 + P.Z * Row2 + Row3
+            const VectorRegister4Float Position = VectorLoadFloat3(&BindPositions[VertexIdx].X);
+            VectorRegister4Float Skinned = VectorMultiplyAdd(VectorReplicate(Position, 2), Row2, Row3);
+            Skinned = VectorMultiplyAdd(VectorReplicate(Position, 1), Row1, Skinned);
+            Skinned = VectorMultiplyAdd(VectorReplicate(Position, 0), Row0, Skinned);
+            const int32 OutIdx = VertexIdx - StartVertex;
+            VectorStoreFloat3(Skinned, &OutPositions[OutIdx].X);
+
+            // 탄젠트 프레임은 같은 블렌딩 행렬의 회전 부분으로 변환 (엔진 GPU 스키닝처럼 비균등 스케일 보정은 하지 않음)
+            const FPackedNormal BindTangentZ = Buffer.GetBindTangentZ(VertexIdx);
+            FVector4f SkinnedTangentX;
+            FVector4f SkinnedNormal;
+            VectorStore(TransformDirectionBlended(VectorSet_W0(Buffer.GetBindTangentX(VertexIdx).GetVectorRegister()), Row0, Row1, Row2), &SkinnedTangentX.X);
+            VectorStore(TransformDirectionBlended(VectorSet_W0(BindTangentZ.GetVectorRegister()), Row0, Row1, Row2), &SkinnedNormal.X);
+            OutTangents[OutIdx * 2 + 0] = FPackedNormal(SkinnedTangentX);
+            OutTangents[OutIdx * 2 + 1] = PackTangentZ(SkinnedNormal, BindTangentZ);
+        }
+    }
+
+    void SkinVertices(const FProcMeshSkinningBuffer& Buffer, const FMatrix44f* Palette, int32 StartVertex, int32 NumVertices, FVector3f* OutPositions, FPackedNormal* OutTangents)
+    {
+        if (Buffer.IsEmpty() || NumVertices <= 0)
+        {
+            return;
+        }
+
+        if (!CVarSkinningUseSimd.GetValueOnAnyThread())
+        {
+            SkinVerticesScalar(Buffer, Palette, StartVertex, NumVertices, OutPositions, OutTangents);
+            return;
+        }
+
+        SkinVerticesSimd(Buffer, Palette, StartVertex, NumVertices, OutPositions, OutTangents);
+
+        if (CVarSkinningValidateSimd.GetValueOnAnyThread())
+        {
+            // 청크 크기 레퍼런스만 워커 스레드의 FMemStack에서 잡음. 탄젠트는 8비트 양자화 후 비교가 무의미하므로 위치만 비교
+            // (탄젠트까지 포함한 정확성 검증은 AdvancedAction.Skinning.SimdMatchesScalar 자동화 테스트)
+            FMemMark ScratchMark(FMemStack::Get());
+            TArray<FVector3f, TMemStackAllocator<>> Reference;
+            TArray<FPackedNormal, TMemStackAllocator<>> ReferenceTangents;
+            Reference.SetNumUninitialized(NumVertices);
+            ReferenceTangents.SetNumUninitialized(NumVertices * 2);
+            SkinVerticesScalar(Buffer, Palette, StartVertex, NumVertices, Reference.GetData(), ReferenceTangents.GetData());
+
+            const float Tolerance = CVarSkinningValidateTolerance.GetValueOnAnyThread();
+            float MaxError = 0.f;
+            int32 WorstVertex = INDEX_NONE;
+            for (int32 OutIdx = 0; OutIdx < NumVertices; ++OutIdx)
+            {
+                const float Error = FVector3f::Dist(Reference[OutIdx], OutPositions[OutIdx]);
+                if (Error > MaxError)
+                {
+                    MaxError = Error;
+                    WorstVertex = StartVertex + OutIdx;
+                }
+            }
+            if (MaxError > Tolerance)
+            {
+                UE_LOG(LogAdvancedAction, Warning, TEXT("ProcMeshSkinning: SIMD kernel deviates from scalar reference by %f (vertex %d, tolerance %f)."), MaxError, WorstVertex, Tolerance);
+            }
+        }
+    }
+
+    void SkinJobsParallel(TArrayView<FProcMeshSkinningJob* const> Jobs)
+    {
+        SCOPE_CYCLE_COUNTER(STAT_ProcMeshSkinning_Kernel);
+        TRACE_CPUPROFILER_EVENT_SCOPE(ProcMeshSkinning::SkinJobsParallel);
+
+        struct FChunk
+        {
+            FProcMeshSkinningJob* Job;
+            int32 StartVertex;
+            int32 NumVertices;
+        };
+
+        const int32 ChunkSize = CVarSkinningChunkSize.GetValueOnAnyThread();
+
+        // 모든 조각의 버텍스를 하나의 청크 목록으로 평탄화해 조각 간 작업량 편차를 흡수
+        TArray<FChunk, TInlineAllocator<32>> Chunks;
+        for (FProcMeshSkinningJob* Job : Jobs)
+        {
+            if (!Job || !Job->Buffer || Job->Buffer->IsEmpty() || !Job->Buffer->HasBindTangentFrames())
+            {
+                continue;
+            }
+
+            const int32 NumVertices = Job->Buffer->Num();
+            Job->SkinnedPositions.SetNumUninitialized(NumVertices, EAllowShrinking::No);
+            Job->SkinnedTangents.SetNumUninitialized(NumVertices * 2, EAllowShrinking::No);
+
+            const int32 Step = ChunkSize > 0 ? ChunkSize : NumVertices;
+            for (int32 StartVertex = 0; StartVertex < NumVertices; StartVertex += Step)
+            {
+                Chunks.Add({ Job, StartVertex, FMath::Min(Step, NumVertices - StartVertex) });
+            }
+        }
+
+        // 청크가 하나뿐이거나 병렬화를 끈 경우(ChunkSize <= 0, 조각마다 청크 하나) 태스크 디스패치 없이 호출 스레드에서 처리
+        const EParallelForFlags Flags = Chunks.Num() > 1 && ChunkSize > 0 ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread;
+        ParallelFor(Chunks.Num(), [&Chunks](int32 ChunkIndex)
+        {
+            const FChunk& Chunk = Chunks[ChunkIndex];
+            SkinVertices(*Chunk.Job->Buffer, Chunk.Job->Palette.GetData(), Chunk.StartVertex, Chunk.NumVertices,
+                Chunk.Job->SkinnedPositions.GetData() + Chunk.StartVertex, Chunk.Job->SkinnedTangents.GetData() + Chunk.StartVertex * 2);
+        }, Flags);
+    }
+}
@@ -0,0 +1,604 @@
+#include "ProcMeshSlicer.h"
+
+#include "AdvancedActionFeature.h"
+#include "AdvancedActionFeatureStats.h"
+#include "Algo/Reverse.h"
+
+namespace
+{
+    // 캡 UV 타일 크기 (UKismetProceduralMeshLibrary::SliceProceduralMesh와 동일)
+    constexpr float CapUVTileSize = 64.f;
+
+    // 캡 윤곽을 만들 때 같은 위치로 취급하는 교차점 간격
+    constexpr double CapWeldTolerance = 0.01;
+
+    // 캡 윤곽에서 일직선으로 취급하는 세 점의 2D 외적 (평행사변형 면적, cm^2)
+    constexpr double CapCollinearTolerance = 1.e-6;
+
+    FORCEINLINE uint32 HashCell(int64 X, int64 Y, int64 Z)
+    {
+        return static_cast<uint32>(X * 73856093) ^ static_cast<uint32>(Y * 19349663) ^ static_cast<uint32>(Z * 83492791);
+    }
+
+    int32 AddVertex(FProcMeshSliceHalf& Out, bool bHasColors, const FVector& Position, const FVector& Normal, const FProcMeshTangent& Tangent, const FVector2D& UV, const FLinearColor& Color, const FProcMeshVertexProvenance& Origin)
+    {
+        FProcMeshGeometry& Geometry = Out.Geometry;
+        const int32 NewIndex = Geometry.Vertices.Add(Position);
+        Geometry.Normals.Add(Normal);
+        Geometry.Tangents.Add(Tangent);
+        Geometry.UV0.Add(UV);
+        if (bHasColors)
+        {
+            Geometry.VertexColors.Add(Color);
+        }
+        Out.Provenance.Add(Origin);
+        return NewIndex;
+    }
+
+    void ReserveHalf(FProcMeshSliceHalf& Out, int32 NumVertices)
+    {
+        FProcMeshGeometry& Geometry = Out.Geometry;
+        Geometry.Vertices.Reserve(NumVertices);
+        Geometry.Normals.Reserve(NumVertices);
+        Geometry.Tangents.Reserve(NumVertices);
+        Geometry.UV0.Reserve(NumVertices);
+        Out.Provenance.Reserve(NumVertices);
+    }
+}
+
+void FProcMeshGeometry::ExtractSection(int32 SectionIdx, FProcMeshGeometry& OutSection, TArray<int32>& OutVertexIndices, TArray<int32>& SourceToSection) const
+{
+    OutSection.Reset();
+    OutSection.SectionIndices.SetNum(1);
+    OutVertexIndices.Reset();
+    if (!SectionIndices.IsValidIndex(SectionIdx))
+    {
+        return;
+    }
+
+    if (SourceToSection.Num() != NumVertices())
+    {
+        SourceToSection.Init(INDEX_NONE, NumVertices());
+    }
+
+    const TArray<int32>& Indices = SectionIndices[SectionIdx];
+    TArray<int32>& OutIndices = OutSection.SectionIndices[0];
+    OutIndices.SetNumUninitialized(Indices.Num());
+    for (int32 Idx = 0; Idx < Indices.Num(); ++Idx)
+    {
+        const int32 SourceIndex = Indices[Idx];
+        int32& SectionIndex = SourceToSection[SourceIndex];
+        if (SectionIndex == INDEX_NONE)
+        {
+            SectionIndex = OutVertexIndices.Add(SourceIndex);
+        }
+        OutIndices[Idx] = SectionIndex;
+    }
+
+    const int32 NumSectionVertices = OutVertexIndices.Num();
+    const bool bHasColors = VertexColors.Num() == NumVertices();
+    OutSection.Vertices.SetNumUninitialized(NumSectionVertices);
+    OutSection.Normals.SetNumUninitialized(NumSectionVertices);
+    OutSection.Tangents.SetNumUninitialized(NumSectionVertices);
+    OutSection.UV0.SetNumUninitialized(NumSectionVertices);
+    OutSection.VertexColors.SetNumUninitialized(bHasColors ? NumSectionVertices : 0);
+    for (int32 SectionVertexIdx = 0; SectionVertexIdx < NumSectionVertices; ++SectionVertexIdx)
+    {
+        const int32 SourceIndex = OutVertexIndices[SectionVertexIdx];
+        OutSection.Vertices[SectionVertexIdx] = Vertices[SourceIndex];
+        OutSection.Normals[SectionVertexIdx] = Normals[SourceIndex];
+        OutSection.Tangents[SectionVertexIdx] = Tangents[SourceIndex];
+        OutSection.UV0[SectionVertexIdx] = UV0[SourceIndex];
+        if (bHasColors)
+        {
+            OutSection.VertexColors[SectionVertexIdx] = VertexColors[SourceIndex];
+        }
+
+        // 다음 섹션을 위해 방문한 항목만 되돌림
+        SourceToSection[SourceIndex] = INDEX_NONE;
+    }
+}
+
+bool FProcMeshSlicer::Slice(const FProcMeshGeometry& Source, const FPlane& SlicePlane, bool bCreateCap, FProcMeshSliceHalf& OutPositive, FProcMeshSliceHalf& OutNegative)
+{
+    OutPositive.Reset();
+    OutNegative.Reset();
+
+    const int32 NumSourceVertices = Source.NumVertices();
+    const int32 NumSections = Source.SectionIndices.Num();
+    OutPositive.Geometry.SectionIndices.SetNum(NumSections);
+    OutNegative.Geometry.SectionIndices.SetNum(NumSections);
+
+    // 최악의 경우(모든 버텍스가 한쪽)를 기준으로 한 번에 예약해 삼각형 루프 중 재할당을 막음
+    ReserveHalf(OutPositive, NumSourceVertices);
+    ReserveHalf(OutNegative, NumSourceVertices);
+    const bool bHasColors = Source.VertexColors.Num() > 0;
+    if (bHasColors)
+    {
+        OutPositive.Geometry.VertexColors.Reserve(NumSourceVertices);
+        OutNegative.Geometry.VertexColors.Reserve(NumSourceVertices);
+    }
+
+    // 버텍스별 평면 거리. 양(+)이면 Positive 쪽
+    VertDistance.SetNumUninitialized(NumSourceVertices, EAllowShrinking::No);
+    for (int32 VertexIdx = 0; VertexIdx < NumSourceVertices; ++VertexIdx)
+    {
+        VertDistance[VertexIdx] = SlicePlane.PlaneDot(Source.Vertices[VertexIdx]);
+    }
+
+    SourceToPositive.Init(INDEX_NONE, NumSourceVertices);
+    SourceToNegative.Init(INDEX_NONE, NumSourceVertices);
+    FirstCrossingEdge.Init(INDEX_NONE, NumSourceVertices);
+    CrossingEdges.Reset();
+    CapPoints.Reset();
+    CapSegments.Reset();
+
+    for (int32 SectionIdx = 0; SectionIdx < NumSections; ++SectionIdx)
+    {
+        const TArray<int32>& Indices = Source.SectionIndices[SectionIdx];
+        TArray<int32>& PositiveIndices = OutPositive.Geometry.SectionIndices[SectionIdx];
+        TArray<int32>& NegativeIndices = OutNegative.Geometry.SectionIndices[SectionIdx];
+        PositiveIndices.Reserve(Indices.Num());
+        NegativeIndices.Reserve(Indices.Num());
+
+        for (int32 BaseIndex = 0; BaseIndex + 2 < Indices.Num(); BaseIndex += 3)
+        {
+            const int32 SourceV[3] = { Indices[BaseIndex], Indices[BaseIndex + 1], Indices[BaseIndex + 2] };
+            const bool bInside[3] = { VertDistance[SourceV[0]] > 0.f, VertDistance[SourceV[1]] > 0.f, VertDistance[SourceV[2]] > 0.f };
+
+            // 삼각형 전체가 한쪽에 있으면 그대로 복사
+            if (bInside[0] && bInside[1] && bInside[2])
+            {
+                for (int32 Corner = 0; Corner < 3; ++Corner) PositiveIndices.Add(CopyVertex(Source, SourceV[Corner], OutPositive, SourceToPositive));
+                continue;
+            }
+            if (!bInside[0] && !bInside[1] && !bInside[2])
+            {
+                for (int32 Corner = 0; Corner < 3; ++Corner) NegativeIndices.Add(CopyVertex(Source, SourceV[Corner], OutNegative, SourceToNegative));
+                continue;
+            }
+
+            // 걸친 삼각형: 각 쪽 다각형(최대 4각형)을 만들고 팬으로 분할
+            int32 PositivePoly[4];
+            int32 NumPositive = 0;
+            int32 NegativePoly[4];
+            int32 NumNegative = 0;
+            int32 SegmentPoints[2];
+            int32 NumSegmentPoints = 0;
+
+            for (int32 ThisVert = 0; ThisVert < 3; ++ThisVert)
+            {
+                const int32 NextVert = (ThisVert + 1) % 3;
+
+                if (bInside[ThisVert])
+                {
+                    PositivePoly[NumPositive++] = CopyVertex(Source, SourceV[ThisVert], OutPositive, SourceToPositive);
+                }
+                else
+                {
+                    NegativePoly[NumNegative++] = CopyVertex(Source, SourceV[ThisVert], OutNegative, SourceToNegative);
+                }
+
+                if (bInside[ThisVert] != bInside[NextVert])
+                {
+                    const FCrossingEdge& Edge = CrossingEdges[FindOrAddCrossingEdge(Source, SourceV[ThisVert], SourceV[NextVert], bCreateCap, OutPositive, OutNegative)];
+                    PositivePoly[NumPositive++] = Edge.PositiveVertex;
+                    NegativePoly[NumNegative++] = Edge.NegativeVertex;
+
+                    if (Edge.CapPoint != INDEX_NONE && NumSegmentPoints < 2)
+                    {
+                        SegmentPoints[NumSegmentPoints++] = Edge.CapPoint;
+                    }
+                }
+            }
+
+            for (int32 Corner = 2; Corner < NumPositive; ++Corner)
+            {
+                PositiveIndices.Add(PositivePoly[0]);
+                PositiveIndices.Add(PositivePoly[Corner - 1]);
+                PositiveIndices.Add(PositivePoly[Corner]);
+            }
+            for (int32 Corner = 2; Corner < NumNegative; ++Corner)
+            {
+                NegativeIndices.Add(NegativePoly[0]);
+                NegativeIndices.Add(NegativePoly[Corner - 1]);
+                NegativeIndices.Add(NegativePoly[Corner]);
+            }
+
+            if (NumSegmentPoints == 2)
+            {
+                CapSegments.Add(TPair<int32, int32>(SegmentPoints[0], SegmentPoints[1]));
+            }
+        }
+    }
+
+    if (bCreateCap && CapSegments.Num() > 0)
+    {
+        BuildCaps(SlicePlane, OutPositive, OutNegative);
+    }
+
+    return OutPositive.Geometry.HasTriangles() || OutNegative.Geometry.HasTriangles();
+}
+
+void FProcMeshSlicer::Empty()
+{
+    VertDistance.Empty();
+    SourceToPositive.Empty();
+    SourceToNegative.Empty();
+    FirstCrossingEdge.Empty();
+    CrossingEdges.Empty();
+    CapPoints.Empty();
+    CapSegments.Empty();
+    CapWeldBuckets.Empty();
+    CapWeldNext.Empty();
+    CapPointToNode.Empty();
+    CapNodeToPoint.Empty();
+    CapNodeSegmentOffsets.Empty();
+    CapNodeSegments.Empty();
+    CapUsedSegments.Empty();
+    CapLoopPoints.Empty();
+    CapLoopStarts.Empty();
+    CapPoints2D.Empty();
+    CapPolygon.Empty();
+    CapTriangles.Empty();
+    CapPointToVertex.Empty();
+}
+
+int32 FProcMeshSlicer::CopyVertex(const FProcMeshGeometry& Source, int32 SourceIndex, FProcMeshSliceHalf& Out, TArray<int32>& SourceToOutput)
+{
+    int32& Mapped = SourceToOutput[SourceIndex];
+    if (Mapped == INDEX_NONE)
+    {
+        Mapped = AddVertex(Out, Source.VertexColors.Num() > 0,
+            Source.Vertices[SourceIndex],
+            Source.Normals.IsValidIndex(SourceIndex) ? Source.Normals[SourceIndex] : FVector::UpVector,
+            Source.Tangents.IsValidIndex(SourceIndex) ? Source.Tangents[SourceIndex] : FProcMeshTangent(),
+            Source.UV0.IsValidIndex(SourceIndex) ? Source.UV0[SourceIndex] : FVector2D::ZeroVector,
+            Source.VertexColors.IsValidIndex(SourceIndex) ? Source.VertexColors[SourceIndex] : FLinearColor::White,
+            FProcMeshVertexProvenance(SourceIndex));
+    }
+    return Mapped;
+}
+
+int32 FProcMeshSlicer::FindOrAddCrossingEdge(const FProcMeshGeometry& Source, int32 SourceA, int32 SourceB, bool bCreateCap, FProcMeshSliceHalf& OutPositive, FProcMeshSliceHalf& OutNegative)
+{
+    // 에지 방향과 무관하게 같은 보간점이 나오도록 작은 인덱스 기준으로 찾고 Alpha를 계산
+    const int32 EdgeA = FMath::Min(SourceA, SourceB);
+    const int32 EdgeB = FMath::Max(SourceA, SourceB);
+
+    for (int32 EdgeIdx = FirstCrossingEdge[EdgeA]; EdgeIdx != INDEX_NONE; EdgeIdx = CrossingEdges[EdgeIdx].NextEdge)
+    {
+        if (CrossingEdges[EdgeIdx].OtherVertex == EdgeB)
+        {
+            return EdgeIdx;
+        }
+    }
+
+    const float DistA = VertDistance[EdgeA];
+    const float DistB = VertDistance[EdgeB];
+    const float Alpha = FMath::Clamp(DistA / (DistA - DistB), 0.f, 1.f);
+    auto Lerp = [Alpha](const auto& A, const auto& B) { return A + (B - A) * Alpha; };
+
+    const FVector Position = Lerp(Source.Vertices[EdgeA], Source.Vertices[EdgeB]);
+    const FVector Normal = Source.Normals.IsValidIndex(EdgeA) && Source.Normals.IsValidIndex(EdgeB)
+        ? Lerp(Source.Normals[EdgeA], Source.Normals[EdgeB]).GetSafeNormal() : FVector::UpVector;
+    FProcMeshTangent Tangent;
+    if (Source.Tangents.IsValidIndex(EdgeA) && Source.Tangents.IsValidIndex(EdgeB))
+    {
+        Tangent = FProcMeshTangent(Lerp(Source.Tangents[EdgeA].TangentX, Source.Tangents[EdgeB].TangentX).GetSafeNormal(), Source.Tangents[EdgeA].bFlipTangentY);
+    }
+    const FVector2D UV = Source.UV0.IsValidIndex(EdgeA) && Source.UV0.IsValidIndex(EdgeB)
+        ? Lerp(Source.UV0[EdgeA], Source.UV0[EdgeB]) : FVector2D::ZeroVector;
+    const FLinearColor Color = Source.VertexColors.IsValidIndex(EdgeA) && Source.VertexColors.IsValidIndex(EdgeB)
+        ? Lerp(Source.VertexColors[EdgeA], Source.VertexColors[EdgeB]) : FLinearColor::White;
+    const FProcMeshVertexProvenance Origin(EdgeA, EdgeB, Alpha);
+    const bool bHasColors = Source.VertexColors.Num() > 0;
+
+    FCrossingEdge& Edge = CrossingEdges.AddDefaulted_GetRef();
+    Edge.OtherVertex = EdgeB;
+    Edge.NextEdge = FirstCrossingEdge[EdgeA];
+    Edge.PositiveVertex = AddVertex(OutPositive, bHasColors, Position, Normal, Tangent, UV, Color, Origin);
+    Edge.NegativeVertex = AddVertex(OutNegative, bHasColors, Position, Normal, Tangent, UV, Color, Origin);
+    Edge.CapPoint = bCreateCap ? CapPoints.Add({ Position, Origin }) : INDEX_NONE;
+
+    const int32 NewEdgeIdx = CrossingEdges.Num() - 1;
+    FirstCrossingEdge[EdgeA] = NewEdgeIdx;
+    return NewEdgeIdx;
+}
+
+void FProcMeshSlicer::BuildCapLoops()
+{
+    // 위치 용접: 허용 거리 안의 교차점은 하나의 노드로.
+    // UV 이음새처럼 같은 위치에 중복된 입력 버텍스가 있어도 윤곽이 끊기지 않음.
+    // 공간 해시도 밀집 배열 (버킷 -> 첫 점, 점 -> 같은 버킷의 다음 점)
+    const int32 NumPoints = CapPoints.Num();
+    const double CellSize = CapWeldTolerance * 2.0;
+    const double ToleranceSquared = CapWeldTolerance * CapWeldTolerance;
+    const int32 NumBuckets = static_cast<int32>(FMath::RoundUpToPowerOfTwo(static_cast<uint32>(FMath::Max(NumPoints * 2, 16))));
+    const uint32 BucketMask = static_cast<uint32>(NumBuckets - 1);
+    CapWeldBuckets.Init(INDEX_NONE, NumBuckets);
+    CapWeldNext.SetNumUninitialized(NumPoints, EAllowShrinking::No);
+    CapNodeToPoint.Reset();
+    CapPointToNode.SetNumUninitialized(NumPoints, EAllowShrinking::No);
+
+    // 셀 크기가 허용 거리의 두 배이므로, 허용 거리 안의 점은 자기 셀이거나 축마다 가까운 쪽 이웃 셀에 있음 (최대 8셀 조회)
+    for (int32 PointIdx = 0; PointIdx < NumPoints; ++PointIdx)
+    {
+        const FVector& Position = CapPoints[PointIdx].Position;
+        const FVector Scaled = Position / CellSize;
+        const int64 CellX = static_cast<int64>(FMath::FloorToDouble(Scaled.X));
+        const int64 CellY = static_cast<int64>(FMath::FloorToDouble(Scaled.Y));
+        const int64 CellZ = static_cast<int64>(FMath::FloorToDouble(Scaled.Z));
+        const int64 StepX = Scaled.X - CellX < 0.5 ? -1 : 1;
+        const int64 StepY = Scaled.Y - CellY < 0.5 ? -1 : 1;
+        const int64 StepZ = Scaled.Z - CellZ < 0.5 ? -1 : 1;
+
+        int32 Node = INDEX_NONE;
+        for (int32 Neighbor = 0; Neighbor < 8 && Node == INDEX_NONE; ++Neighbor)
+        {
+            const uint32 Bucket = HashCell(CellX + ((Neighbor & 1) ? StepX : 0), CellY + ((Neighbor & 2) ? StepY : 0), CellZ + ((Neighbor & 4) ? StepZ : 0)) & BucketMask;
+            for (int32 Other = CapWeldBuckets[Bucket]; Other != INDEX_NONE; Other = CapWeldNext[Other])
+            {
+                // 해시 충돌로 다른 셀의 점이 섞일 수 있으므로 거리로 확인
+                if (FVector::DistSquared(Position, CapPoints[Other].Position) <= ToleranceSquared)
+                {
+                    Node = CapPointToNode[Other];
+                    break;
+                }
+            }
+        }
+        CapPointToNode[PointIdx] = Node != INDEX_NONE ? Node : CapNodeToPoint.Add(PointIdx);
+
+        const uint32 Bucket = HashCell(CellX, CellY, CellZ) & BucketMask;
+        CapWeldNext[PointIdx] = CapWeldBuckets[Bucket];
+        CapWeldBuckets[Bucket] = PointIdx;
+    }
+
+    // 노드 -> 선분 인접 리스트 (CSR). 닫힌 2-매니폴드 절단면이면 노드마다 선분 2개
+    const int32 NumNodes = CapNodeToPoint.Num();
+    const int32 NumSegments = CapSegments.Num();
+    CapNodeSegmentOffsets.SetNumZeroed(NumNodes + 1, EAllowShrinking::No);
+    CapUsedSegments.Init(false, NumSegments);
+    for (int32 SegmentIdx = 0; SegmentIdx < NumSegments; ++SegmentIdx)
+    {
+        const int32 NodeA = CapPointToNode[CapSegments[SegmentIdx].Key];
+        const int32 NodeB = CapPointToNode[CapSegments[SegmentIdx].Value];
+        if (NodeA == NodeB)
+        {
+            CapUsedSegments[SegmentIdx] = true; // 용접으로 길이가 0이 된 선분
+            continue;
+        }
+        ++CapNodeSegmentOffsets[NodeA + 1];
+        ++CapNodeSegmentOffsets[NodeB + 1];
+    }
+    for (int32 Node = 0; Node < NumNodes; ++Node)
+    {
+        CapNodeSegmentOffsets[Node + 1] += CapNodeSegmentOffsets[Node];
+    }
+    CapNodeSegments.SetNumUninitialized(CapNodeSegmentOffsets[NumNodes], EAllowShrinking::No);
+    // 오프셋을 커서로 쓰며 채운 뒤 (각 노드의 끝 위치가 됨) 한 칸씩 밀어 시작 위치로 복원
+    for (int32 SegmentIdx = 0; SegmentIdx < NumSegments; ++SegmentIdx)
+    {
+        if (CapUsedSegments[SegmentIdx]) continue;
+        CapNodeSegments[CapNodeSegmentOffsets[CapPointToNode[CapSegments[SegmentIdx].Key]]++] = SegmentIdx;
+        CapNodeSegments[CapNodeSegmentOffsets[CapPointToNode[CapSegments[SegmentIdx].Value]]++] = SegmentIdx;
+    }
+    for (int32 Node = NumNodes; Node > 0; --Node)
+    {
+        CapNodeSegmentOffsets[Node] = CapNodeSegmentOffsets[Node - 1];
+    }
+    CapNodeSegmentOffsets[0] = 0;
+
+    // 선분을 따라가며 닫힌 윤곽선만 모음. 닫히지 않는 체인은 버림
+    CapLoopPoints.Reset();
+    CapLoopStarts.Reset();
+    for (int32 StartSegment = 0; StartSegment < NumSegments; ++StartSegment)
+    {
+        if (CapUsedSegments[StartSegment]) continue;
+        CapUsedSegments[StartSegment] = true;
+
+        const int32 LoopStart = CapLoopPoints.Num();
+        const int32 StartNode = CapPointToNode[CapSegments[StartSegment].Key];
+        int32 CurrentNode = CapPointToNode[CapSegments[StartSegment].Value];
+        CapLoopPoints.Add(CapNodeToPoint[StartNode]);
+
+        bool bClosed = false;
+        while (true)
+        {
+            if (CurrentNode == StartNode)
+            {
+                bClosed = true;
+                break;
+            }
+            CapLoopPoints.Add(CapNodeToPoint[CurrentNode]);
+
+            int32 NextSegment = INDEX_NONE;
+            for (int32 Slot = CapNodeSegmentOffsets[CurrentNode]; Slot < CapNodeSegmentOffsets[CurrentNode + 1]; ++Slot)
+            {
+                if (!CapUsedSegments[CapNodeSegments[Slot]])
+                {
+                    NextSegment = CapNodeSegments[Slot];
+                    break;
+                }
+            }
+            if (NextSegment == INDEX_NONE) break; // 열린 체인
+
+            CapUsedSegments[NextSegment] = true;
+            const int32 NextA = CapPointToNode[CapSegments[NextSegment].Key];
+            const int32 NextB = CapPointToNode[CapSegments[NextSegment].Value];
+            CurrentNode = NextA == CurrentNode ? NextB : NextA;
+        }
+
+        if (bClosed && CapLoopPoints.Num() - LoopStart >= 3)
+        {
+            CapLoopStarts.Add(LoopStart);
+        }
+        else
+        {
+            CapLoopPoints.SetNum(LoopStart, EAllowShrinking::No);
+        }
+    }
+    CapLoopStarts.Add(CapLoopPoints.Num());
+}
+
+bool FProcMeshSlicer::TriangulateLoop(TConstArrayView<int32> Loop)
+{
+    // 윤곽선 하나를 귀 깎기(ear clipping)로 삼각분할. 출력은 CapPoints2D 기준 시계 방향 삼각형
+    auto Cross = [this](int32 A, int32 B, int32 C)
+    {
+        return FVector2D::CrossProduct(CapPoints2D[B] - CapPoints2D[A], CapPoints2D[C] - CapPoints2D[A]);
+    };
+
+    CapPolygon.Reset();
+    CapPolygon.Append(Loop.GetData(), Loop.Num());
+
+    // 시계 방향(부호 있는 면적 < 0)으로 맞춤
+    double SignedArea = 0.0;
+    for (int32 Idx = 0; Idx < CapPolygon.Num(); ++Idx)
+    {
+        SignedArea += FVector2D::CrossProduct(CapPoints2D[CapPolygon[Idx]], CapPoints2D[CapPolygon[(Idx + 1) % CapPolygon.Num()]]);
+    }
+    if (SignedArea > 0.0)
+    {
+        Algo::Reverse(CapPolygon);
+    }
+
+    // 일직선 위의 점은 외적이 0이라 귀가 될 수 없어 분할이 멈추므로 미리 제거 (면적에는 영향 없음)
+    for (int32 Idx = 0; CapPolygon.Num() > 3 && Idx < CapPolygon.Num();)
+    {
+        const int32 Count = CapPolygon.Num();
+        if (FMath::Abs(Cross(CapPolygon[(Idx + Count - 1) % Count], CapPolygon[Idx], CapPolygon[(Idx + 1) % Count])) <= CapCollinearTolerance)
+        {
+            CapPolygon.RemoveAt(Idx, 1, EAllowShrinking::No);
+            Idx = FMath::Max(Idx - 1, 0); // 앞 점이 새로 일직선이 됐을 수 있음
+        }
+        else
+        {
+            ++Idx;
+        }
+    }
+
+    int32 Guard = CapPolygon.Num() * CapPolygon.Num();
+    int32 Cursor = 0;
+    while (CapPolygon.Num() > 3 && Guard-- > 0)
+    {
+        const int32 Count = CapPolygon.Num();
+        const int32 Prev = CapPolygon[(Cursor + Count - 1) % Count];
+        const int32 Curr = CapPolygon[Cursor % Count];
+        const int32 Next = CapPolygon[(Cursor + 1) % Count];
+
+        // 귀를 잘라낸 뒤 새로 일직선이 된 점은 삼각형 없이 제거
+        const double CurrCross = Cross(Prev, Curr, Next);
+        if (FMath::Abs(CurrCross) <= CapCollinearTolerance)
+        {
+            CapPolygon.RemoveAt(Cursor % Count, 1, EAllowShrinking::No);
+            continue;
+        }
+
+        bool bIsEar = CurrCross < 0.0;
+        for (int32 Other = 0; bIsEar && Other < Count; ++Other)
+        {
+            const int32 Candidate = CapPolygon[Other];
+            if (Candidate == Prev || Candidate == Curr || Candidate == Next) continue;
+
+            // 후보 점이 삼각형 내부(시계 방향이므로 세 외적 모두 <= 0)면 귀가 아님
+            if (Cross(Prev, Curr, Candidate) <= 0.0 && Cross(Curr, Next, Candidate) <= 0.0 && Cross(Next, Prev, Candidate) <= 0.0)
+            {
+                bIsEar = false;
+            }
+        }
+
+        if (bIsEar)
+        {
+            CapTriangles.Add(Prev);
+            CapTriangles.Add(Curr);
+            CapTriangles.Add(Next);
+            CapPolygon.RemoveAt(Cursor % Count, 1, EAllowShrinking::No);
+        }
+        else
+        {
+            ++Cursor;
+        }
+    }
+
+    if (CapPolygon.Num() > 3)
+    {
+        return false;
+    }
+    if (CapPolygon.Num() == 3 && FMath::Abs(Cross(CapPolygon[0], CapPolygon[1], CapPolygon[2])) > CapCollinearTolerance)
+    {
+        CapTriangles.Append(CapPolygon);
+    }
+    return true;
+}
+
+void FProcMeshSlicer::BuildCaps(const FPlane& SlicePlane, FProcMeshSliceHalf& OutPositive, FProcMeshSliceHalf& OutNegative)
+{
+    BuildCapLoops();
+    const int32 NumLoops = CapLoopStarts.Num() - 1;
+    if (NumLoops <= 0) return;
+
+    // 양쪽 절반의 캡은 서로 반대를 바라봄. 양(+)쪽 절반의 캡은 평면 법선의 반대 방향
+    const FVector PlaneNormal = FVector(SlicePlane).GetSafeNormal();
+    const FVector PositiveFacing = -PlaneNormal;
+
+    // 평면 기저 (U x V = PositiveFacing) 로 2D 투영
+    FVector AxisU, Unused;
+    PositiveFacing.FindBestAxisVectors(AxisU, Unused);
+    const FVector AxisV = PositiveFacing ^ AxisU;
+
+    CapPoints2D.SetNumUninitialized(CapPoints.Num(), EAllowShrinking::No);
+    for (int32 PointIdx = 0; PointIdx < CapPoints.Num(); ++PointIdx)
+    {
+        CapPoints2D[PointIdx] = FVector2D(CapPoints[PointIdx].Position | AxisU, CapPoints[PointIdx].Position | AxisV);
+    }
+
+    // 엔진 규약상 (B-A)x(C-A)가 바라보는 방향의 반대쪽이 앞면.
+    // 기저가 PositiveFacing 기준이므로 2D에서 시계 방향인 삼각형이 PositiveFacing 쪽 앞면이 됨
+    CapTriangles.Reset();
+    int32 NumDroppedLoops = 0;
+    for (int32 LoopIdx = 0; LoopIdx < NumLoops; ++LoopIdx)
+    {
+        const int32 LoopStart = CapLoopStarts[LoopIdx];
+        if (!TriangulateLoop(TConstArrayView<int32>(CapLoopPoints.GetData() + LoopStart, CapLoopStarts[LoopIdx + 1] - LoopStart)))
+        {
+            ++NumDroppedLoops;
+        }
+    }
+    if (NumDroppedLoops > 0)
+    {
+        // 자기 교차 등으로 귀를 찾지 못한 윤곽은 일부만 메워짐
+        INC_DWORD_STAT_BY(STAT_ProcMeshCut_DroppedCapLoops, NumDroppedLoops);
+        UE_LOG(LogAdvancedAction, Warning, TEXT("ProcMeshSlicer: 캡 윤곽 %d개 중 %d개를 끝까지 삼각분할하지 못했습니다. 절단면 일부가 열려 있을 수 있습니다."), NumLoops, NumDroppedLoops);
+    }
+    if (CapTriangles.Num() == 0) return;
+
+    auto AppendCap = [this](FProcMeshSliceHalf& Half, const FVector& Facing, const FVector& TangentX, bool bFlipWinding)
+    {
+        FProcMeshGeometry& Geometry = Half.Geometry;
+        const bool bHasColors = Geometry.VertexColors.Num() > 0;
+        Half.CapSectionIndex = Geometry.SectionIndices.Num();
+        TArray<int32>& Indices = Geometry.SectionIndices.AddDefaulted_GetRef();
+        Indices.Reserve(CapTriangles.Num());
+
+        CapPointToVertex.Init(INDEX_NONE, CapPoints.Num());
+        const FProcMeshTangent CapTangent(TangentX, false);
+        for (int32 TriIdx = 0; TriIdx < CapTriangles.Num(); TriIdx += 3)
+        {
+            for (int32 Corner = 0; Corner < 3; ++Corner)
+            {
+                const int32 PointIdx = CapTriangles[TriIdx + (bFlipWinding ? (3 - Corner) % 3 : Corner)];
+                int32& Vertex = CapPointToVertex[PointIdx];
+                if (Vertex == INDEX_NONE)
+                {
+                    Vertex = AddVertex(Half, bHasColors, CapPoints[PointIdx].Position, Facing, CapTangent,
+                        CapPoints2D[PointIdx] / CapUVTileSize, FLinearColor::White, CapPoints[PointIdx].Origin);
+                }
+                Indices.Add(Vertex);
+            }
+        }
+    };
+
+    AppendCap(OutPositive, PositiveFacing, AxisU, false);
+    AppendCap(OutNegative, -PositiveFacing, -AxisU, true);
+}
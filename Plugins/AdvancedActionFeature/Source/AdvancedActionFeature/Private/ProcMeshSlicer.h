@@ -0,0 +1,157 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProceduralMeshComponent.h"
+#include "ProcMeshSkinning.h"
+
+/**
+ * 섹션들이 하나의 버텍스 배열을 공유하는 프로시저럴 메시 지오메트리.
+ * SectionIndices[i]는 모두 같은 Vertices 배열을 가리킵니다.
+ */
+struct FProcMeshGeometry
+{
+    TArray<FVector> Vertices;
+    TArray<FVector> Normals;
+    TArray<FProcMeshTangent> Tangents;
+    TArray<FVector2D> UV0;
+    TArray<FLinearColor> VertexColors;
+    TArray<TArray<int32>> SectionIndices;
+
+    int32 NumVertices() const { return Vertices.Num(); }
+
+    bool HasTriangles() const
+    {
+        for (const TArray<int32>& Indices : SectionIndices)
+        {
+            if (Indices.Num() > 0) return true;
+        }
+        return false;
+    }
+
+    /** 내용만 비우고 할당(섹션별 인덱스 배열 포함)은 유지합니다. */
+    void Reset()
+    {
+        Vertices.Reset();
+        Normals.Reset();
+        Tangents.Reset();
+        UV0.Reset();
+        VertexColors.Reset();
+        for (TArray<int32>& Indices : SectionIndices)
+        {
+            Indices.Reset();
+        }
+    }
+
+    /**
+     * 섹션 하나가 참조하는 버텍스만 골라 압축된 단일 섹션 지오메트리를 만듭니다. (섹션마다 전체 버텍스 배열을 복제하지 않기 위함)
+     * 섹션 버텍스는 첫 참조 순서로 배치됩니다.
+     * @param OutSection 압축된 버텍스와 SectionIndices[0]만 채워짐. 내부에서 Reset되며 할당을 재사용
+     * @param OutVertexIndices 섹션 버텍스 -> 이 지오메트리의 버텍스
+     * @param SourceToSection 이 지오메트리 버텍스 수 크기의 스크래치. 비어 있으면 INDEX_NONE으로 채우고, 반환 시 다시 INDEX_NONE으로 되돌려 섹션 사이에 재사용
+     */
+    void ExtractSection(int32 SectionIdx, FProcMeshGeometry& OutSection, TArray<int32>& OutVertexIndices, TArray<int32>& SourceToSection) const;
+};
+
+/** 슬라이스 결과의 한쪽 절반 */
+struct FProcMeshSliceHalf
+{
+    // 입력 섹션 순서를 그대로 유지하고, 캡이 있으면 마지막 섹션으로 추가됨
+    FProcMeshGeometry Geometry;
+
+    // Geometry.Vertices와 1:1로 대응하는 입력 버텍스 출처
+    TArray<FProcMeshVertexProvenance> Provenance;
+
+    // 캡 섹션 인덱스 (캡이 없으면 INDEX_NONE)
+    int32 CapSectionIndex = INDEX_NONE;
+
+    void Reset()
+    {
+        Geometry.Reset();
+        Provenance.Reset();
+        CapSectionIndex = INDEX_NONE;
+    }
+};
+
+/**
+ * 평면 슬라이스 엔진.
+ * 입력 삼각형을 한 번만 순회하면서 양쪽 절반과 절단 윤곽을 동시에 만들고, 출력 버텍스마다 입력 버텍스 출처를 기록합니다.
+ * 버텍스/에지 리맵은 해시 대신 입력 버텍스 수 크기의 밀집 배열을 쓰며, 스크래치 배열은 인스턴스에 남겨
+ * 같은 슬라이서로 다시 자를 때 재할당이 일어나지 않습니다. 게임 스레드 전용이 아니지만 인스턴스 하나를 동시에 쓰면 안 됩니다.
+ */
+class FProcMeshSlicer
+{
+public:
+
+    /**
+     * 평면으로 메시를 잘라 양쪽 절반과 캡을 만듭니다.
+     * 평면의 양(+)쪽은 OutPositive, 나머지는 OutNegative로 갑니다.
+     * 같은 입력 에지에서 생긴 교차 버텍스는 인접 삼각형끼리 공유되므로 절단면이 닫힌 상태로 유지됩니다.
+     * 출력 절반은 내부에서 Reset되며 이전 할당을 재사용합니다.
+     * @param Source 입력 지오메트리 (Source의 버텍스 공간 기준 평면)
+     * @param SlicePlane 절단 평면
+     * @param bCreateCap 절단면을 막는 캡 섹션을 양쪽에 만들지 여부
+     * @return 양쪽 중 하나라도 삼각형이 생겼으면 true
+     */
+    bool Slice(const FProcMeshGeometry& Source, const FPlane& SlicePlane, bool bCreateCap, FProcMeshSliceHalf& OutPositive, FProcMeshSliceHalf& OutNegative);
+
+    /** 스크래치 메모리를 해제합니다. */
+    void Empty();
+
+private:
+
+    /** 평면을 가로지르는 입력 에지 하나. 작은 입력 인덱스의 버텍스에서 연결 리스트로 이어짐 */
+    struct FCrossingEdge
+    {
+        int32 OtherVertex;
+        int32 NextEdge;
+        int32 PositiveVertex;
+        int32 NegativeVertex;
+        int32 CapPoint;
+    };
+
+    /** 절단면 위 교차점 (캡 윤곽의 꼭짓점) */
+    struct FCapPoint
+    {
+        FVector Position;
+        FProcMeshVertexProvenance Origin;
+    };
+
+    int32 CopyVertex(const FProcMeshGeometry& Source, int32 SourceIndex, FProcMeshSliceHalf& Out, TArray<int32>& SourceToOutput);
+    int32 FindOrAddCrossingEdge(const FProcMeshGeometry& Source, int32 SourceA, int32 SourceB, bool bCreateCap, FProcMeshSliceHalf& OutPositive, FProcMeshSliceHalf& OutNegative);
+    void BuildCapLoops();
+    /** @return 윤곽을 끝까지 분할했으면 true. 분할이 멈추면 남은 부분은 메우지 않음 */
+    bool TriangulateLoop(TConstArrayView<int32> Loop);
+    void BuildCaps(const FPlane& SlicePlane, FProcMeshSliceHalf& OutPositive, FProcMeshSliceHalf& OutNegative);
+
+    // --- 슬라이스마다 재사용하는 스크래치 ---
+
+    // 입력 버텍스별 평면 거리 (양수면 Positive 쪽)
+    TArray<float> VertDistance;
+
+    // 입력 버텍스 -> 각 절반의 출력 버텍스 (INDEX_NONE이면 아직 복사 안 됨)
+    TArray<int32> SourceToPositive;
+    TArray<int32> SourceToNegative;
+
+    // 입력 버텍스 -> 그 버텍스에서 시작하는 첫 교차 에지 (FCrossingEdge 연결 리스트)
+    TArray<int32> FirstCrossingEdge;
+    TArray<FCrossingEdge> CrossingEdges;
+
+    // 캡 윤곽
+    TArray<FCapPoint> CapPoints;
+    TArray<TPair<int32, int32>> CapSegments;
+    TArray<int32> CapWeldBuckets;
+    TArray<int32> CapWeldNext;
+    TArray<int32> CapPointToNode;
+    TArray<int32> CapNodeToPoint;
+    TArray<int32> CapNodeSegmentOffsets;
+    TArray<int32> CapNodeSegments;
+    TBitArray<> CapUsedSegments;
+    TArray<int32> CapLoopPoints;
+    TArray<int32> CapLoopStarts;
+    TArray<FVector2D> CapPoints2D;
+    TArray<int32> CapPolygon;
+    TArray<int32> CapTriangles;
+    TArray<int32> CapPointToVertex;
+};
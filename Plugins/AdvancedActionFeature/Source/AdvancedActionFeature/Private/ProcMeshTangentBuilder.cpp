@@ -0,0 +1,253 @@
+#include "ProcMeshTangentBuilder.h"
+
+#include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<bool> CVarTangentsBoundaryOnly(
+    TEXT("AdvancedAction.Tangents.BoundaryOnly"),
+    true,
+    TEXT("노멀 재계산 시 절단 경계에서 면을 잃은 버텍스(와 같은 위치의 버텍스)만 다시 계산합니다. false이면 절단 지오메트리 전체를 다시 계산합니다."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarTangentsWeldTolerance(
+    TEXT("AdvancedAction.Tangents.WeldTolerance"),
+    0.001f,
+    TEXT("노멀 재계산 시 같은 위치로 보고 노멀을 공유할 버텍스 사이의 최대 거리 (cm)."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarTangentsChunkSize(
+    TEXT("AdvancedAction.Tangents.ChunkSize"),
+    4096,
+    TEXT("노멀 재계산 시 워커 하나가 처리하는 삼각형/버텍스 수. 0 이하이면 병렬화하지 않습니다."),
+    ECVF_Default);
+
+namespace
+{
+    FORCEINLINE uint32 HashCell(int64 X, int64 Y, int64 Z)
+    {
+        return static_cast<uint32>(X * 73856093) ^ static_cast<uint32>(Y * 19349663) ^ static_cast<uint32>(Z * 83492791);
+    }
+
+    /** [0, Num)을 ChunkSize 단위로 나눠 Function(Start, End)을 병렬 실행합니다. 청크가 하나뿐이면 호출 스레드에서 처리 */
+    template <typename FunctionType>
+    void ParallelForChunks(int32 Num, int32 ChunkSize, const FunctionType& Function)
+    {
+        const int32 Step = ChunkSize > 0 ? ChunkSize : FMath::Max(Num, 1);
+        const int32 NumChunks = FMath::DivideAndRoundUp(Num, Step);
+        const EParallelForFlags Flags = NumChunks > 1 ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread;
+        ParallelFor(NumChunks, [&Function, Num, Step](int32 ChunkIdx)
+        {
+            const int32 Start = ChunkIdx * Step;
+            Function(Start, FMath::Min(Start + Step, Num));
+        }, Flags);
+    }
+}
+
+int32 FProcMeshTangentBuilder::Build(FProcMeshGeometry& Geometry, const TBitArray<>& DirtyVertices)
+{
+    const int32 NumVertices = Geometry.NumVertices();
+    if (NumVertices == 0 || Geometry.Normals.Num() != NumVertices || Geometry.Tangents.Num() != NumVertices || Geometry.UV0.Num() != NumVertices)
+    {
+        return 0;
+    }
+
+    const bool bRecomputeAll = !CVarTangentsBoundaryOnly.GetValueOnAnyThread() || DirtyVertices.Num() != NumVertices;
+    if (!bRecomputeAll && DirtyVertices.Find(true) == INDEX_NONE)
+    {
+        return 0;
+    }
+
+    WeldVertices(Geometry, FMath::Max(static_cast<double>(CVarTangentsWeldTolerance.GetValueOnAnyThread()), UE_KINDA_SMALL_NUMBER));
+
+    // 1. 재계산 대상을 용접 그룹 단위로 전파 (이음매 한쪽만 다시 계산하면 같은 위치에서 노멀이 갈라짐)
+    if (bRecomputeAll)
+    {
+        RecomputeVertices.Init(true, NumVertices);
+    }
+    else
+    {
+        RecomputeVertices.Init(false, NumVertices);
+        for (TConstSetBitIterator<> It(DirtyVertices); It; ++It)
+        {
+            RecomputeVertices[WeldedVertices[It.GetIndex()]] = true;
+        }
+        for (int32 VertexIdx = 0; VertexIdx < NumVertices; ++VertexIdx)
+        {
+            if (RecomputeVertices[WeldedVertices[VertexIdx]])
+            {
+                RecomputeVertices[VertexIdx] = true;
+            }
+        }
+    }
+
+    // 2. 재계산 대상 버텍스를 하나라도 가진 삼각형만 모음 (경계 모드면 대부분의 내부 삼각형은 건너뜀)
+    ActiveCorners.Reset();
+    for (const TArray<int32>& Indices : Geometry.SectionIndices)
+    {
+        for (int32 Corner = 0; Corner + 2 < Indices.Num(); Corner += 3)
+        {
+            if (RecomputeVertices[Indices[Corner]] || RecomputeVertices[Indices[Corner + 1]] || RecomputeVertices[Indices[Corner + 2]])
+            {
+                ActiveCorners.Append(&Indices[Corner], 3);
+            }
+        }
+    }
+
+    const int32 ChunkSize = CVarTangentsChunkSize.GetValueOnAnyThread();
+    const int32 NumActiveTriangles = ActiveCorners.Num() / 3;
+    FaceNormals.SetNumUninitialized(NumActiveTriangles, EAllowShrinking::No);
+    FaceTangents.SetNumUninitialized(NumActiveTriangles, EAllowShrinking::No);
+    FaceBitangents.SetNumUninitialized(NumActiveTriangles, EAllowShrinking::No);
+
+    // 3. 면 단위 노멀/탄젠트 (병렬). 면 노멀 길이(면적의 두 배)로 가중해 큰 면이 더 많이 기여하도록 함
+    ParallelForChunks(NumActiveTriangles, ChunkSize, [this, &Geometry](int32 Start, int32 End)
+    {
+        for (int32 TriIdx = Start; TriIdx < End; ++TriIdx)
+        {
+            const int32 I0 = ActiveCorners[TriIdx * 3 + 0];
+            const int32 I1 = ActiveCorners[TriIdx * 3 + 1];
+            const int32 I2 = ActiveCorners[TriIdx * 3 + 2];
+
+            const FVector3f P0(Geometry.Vertices[I0]);
+            const FVector3f Edge1 = FVector3f(Geometry.Vertices[I1]) - P0;
+            const FVector3f Edge2 = FVector3f(Geometry.Vertices[I2]) - P0;
+
+            // CalculateTangentsForMesh와 같은 감기 방향
+            const FVector3f FaceNormal = Edge2 ^ Edge1;
+            const float FaceWeight = FaceNormal.Size();
+            FaceNormals[TriIdx] = FaceNormal;
+
+            const FVector2f UV0(Geometry.UV0[I0]);
+            const FVector2f DeltaUV1 = FVector2f(Geometry.UV0[I1]) - UV0;
+            const FVector2f DeltaUV2 = FVector2f(Geometry.UV0[I2]) - UV0;
+            const float Determinant = DeltaUV1.X * DeltaUV2.Y - DeltaUV2.X * DeltaUV1.Y;
+            if (FMath::Abs(Determinant) <= UE_SMALL_NUMBER)
+            {
+                // UV가 퇴화한 면은 노멀에만 기여
+                FaceTangents[TriIdx] = FVector3f::ZeroVector;
+                FaceBitangents[TriIdx] = FVector3f::ZeroVector;
+                continue;
+            }
+
+            const FVector3f Tangent = (Edge1 * DeltaUV2.Y - Edge2 * DeltaUV1.Y) / Determinant;
+            const FVector3f Bitangent = (Edge2 * DeltaUV1.X - Edge1 * DeltaUV2.X) / Determinant;
+            FaceTangents[TriIdx] = Tangent.GetSafeNormal() * FaceWeight;
+            FaceBitangents[TriIdx] = Bitangent.GetSafeNormal() * FaceWeight;
+        }
+    });
+
+    // 4. 누적 (직렬, 삼각형 수에 선형). 노멀은 용접 그룹 대표에 모아 이음매 양쪽이 같은 값을 갖도록 함
+    AccumNormals.SetNumUninitialized(NumVertices, EAllowShrinking::No);
+    AccumTangents.SetNumUninitialized(NumVertices, EAllowShrinking::No);
+    AccumBitangents.SetNumUninitialized(NumVertices, EAllowShrinking::No);
+    FMemory::Memzero(AccumNormals.GetData(), NumVertices * sizeof(FVector3f));
+    FMemory::Memzero(AccumTangents.GetData(), NumVertices * sizeof(FVector3f));
+    FMemory::Memzero(AccumBitangents.GetData(), NumVertices * sizeof(FVector3f));
+
+    for (int32 TriIdx = 0; TriIdx < NumActiveTriangles; ++TriIdx)
+    {
+        for (int32 Corner = 0; Corner < 3; ++Corner)
+        {
+            const int32 VertexIdx = ActiveCorners[TriIdx * 3 + Corner];
+            if (!RecomputeVertices[VertexIdx]) continue;
+
+            AccumNormals[WeldedVertices[VertexIdx]] += FaceNormals[TriIdx];
+            AccumTangents[VertexIdx] += FaceTangents[TriIdx];
+            AccumBitangents[VertexIdx] += FaceBitangents[TriIdx];
+        }
+    }
+
+    // 5. 버텍스 마무리 (병렬): 노멀 정규화, 탄젠트를 노멀에 직교화, 바이탄젠트 방향으로 바이노멀 부호 결정
+    ParallelForChunks(NumVertices, ChunkSize, [this, &Geometry](int32 Start, int32 End)
+    {
+        for (int32 VertexIdx = Start; VertexIdx < End; ++VertexIdx)
+        {
+            if (!RecomputeVertices[VertexIdx]) continue;
+
+            const FVector3f SourceNormal(Geometry.Normals[VertexIdx]);
+            const FVector3f SourceTangent(Geometry.Tangents[VertexIdx].TangentX);
+
+            // 면이 모두 퇴화했으면 소스 값 유지
+            const FVector3f Normal = AccumNormals[WeldedVertices[VertexIdx]].GetSafeNormal(UE_SMALL_NUMBER, SourceNormal);
+
+            const FVector3f& AccumTangent = AccumTangents[VertexIdx];
+            FVector3f Tangent = (AccumTangent - Normal * (Normal | AccumTangent)).GetSafeNormal();
+            if (Tangent.IsZero())
+            {
+                Tangent = (SourceTangent - Normal * (Normal | SourceTangent)).GetSafeNormal();
+            }
+            if (Tangent.IsZero())
+            {
+                FVector3f Unused;
+                Normal.FindBestAxisVectors(Tangent, Unused);
+            }
+
+            const bool bFlipTangentY = ((Normal ^ Tangent) | AccumBitangents[VertexIdx]) < 0.f;
+            Geometry.Normals[VertexIdx] = FVector(Normal);
+            Geometry.Tangents[VertexIdx] = FProcMeshTangent(FVector(Tangent), bFlipTangentY);
+        }
+    });
+
+    return RecomputeVertices.CountSetBits();
+}
+
+void FProcMeshTangentBuilder::WeldVertices(const FProcMeshGeometry& Geometry, double Tolerance)
+{
+    const int32 NumVertices = Geometry.NumVertices();
+    const double CellSize = Tolerance * 2.0;
+    const double ToleranceSquared = Tolerance * Tolerance;
+
+    const int32 NumBuckets = static_cast<int32>(FMath::RoundUpToPowerOfTwo(static_cast<uint32>(FMath::Max(NumVertices * 2, 16))));
+    const uint32 BucketMask = static_cast<uint32>(NumBuckets - 1);
+    HashBuckets.Init(INDEX_NONE, NumBuckets);
+    HashNext.SetNumUninitialized(NumVertices, EAllowShrinking::No);
+    WeldedVertices.SetNumUninitialized(NumVertices, EAllowShrinking::No);
+
+    // 셀 크기가 허용 거리의 두 배이므로, 허용 거리 안의 점은 자기 셀이거나 축마다 가까운 쪽 이웃 셀에 있음 (최대 8셀 조회)
+    for (int32 VertexIdx = 0; VertexIdx < NumVertices; ++VertexIdx)
+    {
+        const FVector& Position = Geometry.Vertices[VertexIdx];
+        const FVector Scaled = Position / CellSize;
+        const int64 CellX = static_cast<int64>(FMath::FloorToDouble(Scaled.X));
+        const int64 CellY = static_cast<int64>(FMath::FloorToDouble(Scaled.Y));
+        const int64 CellZ = static_cast<int64>(FMath::FloorToDouble(Scaled.Z));
+        const int64 StepX = Scaled.X - CellX < 0.5 ? -1 : 1;
+        const int64 StepY = Scaled.Y - CellY < 0.5 ? -1 : 1;
+        const int64 StepZ = Scaled.Z - CellZ < 0.5 ? -1 : 1;
+
+        int32 WeldedVertex = VertexIdx;
+        for (int32 Neighbor = 0; Neighbor < 8 && WeldedVertex == VertexIdx; ++Neighbor)
+        {
+            const uint32 Bucket = HashCell(CellX + ((Neighbor & 1) ? StepX : 0), CellY + ((Neighbor & 2) ? StepY : 0), CellZ + ((Neighbor & 4) ? StepZ : 0)) & BucketMask;
+            for (int32 Other = HashBuckets[Bucket]; Other != INDEX_NONE; Other = HashNext[Other])
+            {
+                // 해시 충돌로 다른 셀의 버텍스가 섞일 수 있으므로 거리로 확인
+                if (FVector::DistSquared(Position, Geometry.Vertices[Other]) <= ToleranceSquared)
+                {
+                    WeldedVertex = WeldedVertices[Other];
+                    break;
+                }
+            }
+        }
+        WeldedVertices[VertexIdx] = WeldedVertex;
+
+        const uint32 Bucket = HashCell(CellX, CellY, CellZ) & BucketMask;
+        HashNext[VertexIdx] = HashBuckets[Bucket];
+        HashBuckets[Bucket] = VertexIdx;
+    }
+}
+
+void FProcMeshTangentBuilder::Empty()
+{
+    WeldedVertices.Empty();
+    HashBuckets.Empty();
+    HashNext.Empty();
+    RecomputeVertices.Empty();
+    ActiveCorners.Empty();
+    FaceNormals.Empty();
+    FaceTangents.Empty();
+    FaceBitangents.Empty();
+    AccumNormals.Empty();
+    AccumTangents.Empty();
+    AccumBitangents.Empty();
+}
@@ -0,0 +1,59 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProcMeshSlicer.h"
+
+/**
+ * 절단 지오메트리의 노멀/탄젠트 재계산기. (UKismetProceduralMeshLibrary::CalculateTangentsForMesh 대체)
+ * - 같은 위치를 공유하는 버텍스(UV/섹션 이음매)는 위치 정렬이나 전수 비교 없이 공간 해시로 한 번에 용접하고,
+ * - 표시된 버텍스(절단 경계에서 면을 잃은 버텍스)와 그 용접 그룹만 다시 계산하며 나머지는 소스 노멀/탄젠트를 유지하고,
+ * - 면 단위 계산과 버텍스 마무리를 고정 크기 청크로 나눠 ParallelFor로 처리합니다.
+ * 노멀은 용접 그룹 전체의 면으로, 탄젠트는 UV가 이어지는 버텍스 자신의 면으로만 누적합니다.
+ * 스크래치 배열은 인스턴스에 남아 다음 계산에서 재사용되며, 인스턴스 하나를 동시에 쓰면 안 됩니다.
+ */
+class FProcMeshTangentBuilder
+{
+public:
+
+    /**
+     * 표시된 버텍스의 노멀/탄젠트를 다시 계산해 Geometry에 덮어씁니다.
+     * AdvancedAction.Tangents.BoundaryOnly가 꺼져 있으면 DirtyVertices와 관계없이 전체를 다시 계산합니다.
+     * @param Geometry 모든 섹션이 같은 버텍스 배열을 공유하는 지오메트리
+     * @param DirtyVertices 다시 계산할 버텍스 (버텍스 수 크기). 크기가 맞지 않으면 전체를 다시 계산
+     * @return 다시 계산한 버텍스 수
+     */
+    int32 Build(FProcMeshGeometry& Geometry, const TBitArray<>& DirtyVertices);
+
+    /** 스크래치 메모리를 해제합니다. */
+    void Empty();
+
+private:
+
+    /** 위치가 Tolerance 안인 버텍스를 먼저 나온 버텍스로 묶어 WeldedVertices를 채웁니다. */
+    void WeldVertices(const FProcMeshGeometry& Geometry, double Tolerance);
+
+    // 버텍스 -> 용접 그룹 대표 버텍스 (그룹에서 가장 작은 인덱스)
+    TArray<int32> WeldedVertices;
+
+    // 공간 해시: 버킷 -> 첫 버텍스, 버텍스 -> 같은 버킷의 다음 버텍스
+    TArray<int32> HashBuckets;
+    TArray<int32> HashNext;
+
+    // 다시 계산할 버텍스 (용접 그룹 단위로 전파된 결과)
+    TBitArray<> RecomputeVertices;
+
+    // 다시 계산할 버텍스를 하나라도 가진 삼각형의 꼭짓점 (삼각형마다 3개)
+    TArray<int32> ActiveCorners;
+
+    // 활성 삼각형별 면 노멀/탄젠트/바이탄젠트 (면적 가중)
+    TArray<FVector3f> FaceNormals;
+    TArray<FVector3f> FaceTangents;
+    TArray<FVector3f> FaceBitangents;
+
+    // 누적값: 노멀은 그룹 대표 버텍스에, 탄젠트/바이탄젠트는 버텍스 자신에
+    TArray<FVector3f> AccumNormals;
+    TArray<FVector3f> AccumTangents;
+    TArray<FVector3f> AccumBitangents;
+};
@@ -1,6 +1,7 @@
 #include "SkelToProcMeshComponent.h"
 
-#include "KismetProceduralMeshLibrary.h"
+#include "AdvancedActionFeature.h"
+#include "AdvancedActionFeatureStats.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "ProceduralMeshComponent.h"
 #include "Rendering/SkeletalMeshRenderData.h"
@@ -8,17 +9,70 @@
 #include "Engine/SkeletalMesh.h"
 #include "GameFramework/Actor.h" 
 #include "DrawDebugHelpers.h"
+#include "GPUSkinPublicDefs.h"
+#include "HAL/IConsoleManager.h"
+#include "Tasks/Task.h"
+#include "ProcMeshCutBakedData.h"
+#include "ProcMeshCutBudgetSubsystem.h"
+#include "ProcMeshCutBuilder.h"
+#include "ProcMeshComponentPoolSubsystem.h"
+#include "ProcMeshPieceComponent.h"
+#include "SkeletalMeshInfluenceSubsystem.h"
+
+static_assert(USkelToProcMeshComponent::NoCutIndex == FProcMeshCutBuilder::NoCutIndex, "절단 순번 표시값이 빌더와 일치해야 합니다.");
+
+static TAutoConsoleVariable<bool> CVarSkinningThrottle(
+    TEXT("AdvancedAction.Skinning.Throttle"),
+    true,
+    TEXT("조각 스키닝의 가시성/거리/정지 스로틀링을 사용합니다. false이면 bThrottleSkinning과 관계없이 매 프레임 스키닝합니다."),
+    ECVF_Default);
+
+void FSkelToProcMeshSkinningCompletionTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+    // 이번 프레임에 시작한 스키닝이 있을 때만 회수/업로드 (스로틀링된 프레임의 보간 업로드는 주 틱에서 처리)
+    if (Target && IsValid(Target) && Target->SkinningMode == ESkelToProcSkinningMode::Async && Target->PendingSkinningTask.IsValid())
+    {
+        Target->CompleteAsyncSkinning();
+        Target->UploadPresentedSkinning();
+    }
+}
+
+FString FSkelToProcMeshSkinningCompletionTickFunction::DiagnosticMessage()
+{
+    return Target ? Target->GetFullName() + TEXT("[SkinningCompletion]") : TEXT("<NULL>[SkinningCompletion]");
+}
+
+FName FSkelToProcMeshSkinningCompletionTickFunction::DiagnosticContext(bool bDetailed)
+{
+    return Target ? Target->GetClass()->GetFName() : NAME_None;
+}
 
 USkelToProcMeshComponent::USkelToProcMeshComponent()
 {
     PrimaryComponentTick.bCanEverTick = true; // 런타임 스키닝을 위해 틱 활성화
     // PrimaryComponentTick.bStartWithTickEnabled = false; // 기본적으로는 비활성화, 필요할 때만 활성화
+
+    // 비동기 스키닝 결과 회수용. 애니메이션/물리 이후 프레임 후반에 실행
+    SkinningCompletionTick.bCanEverTick = true;
+    SkinningCompletionTick.bStartWithTickEnabled = true;
+    SkinningCompletionTick.TickGroup = TG_PostUpdateWork;
 }
 
 void USkelToProcMeshComponent::BeginPlay()
 {
     Super::BeginPlay();
 
+    if (SkinningMode != ESkelToProcSkinningMode::Synchronous)
+    {
+        // 비동기 모드: 애니메이션이 끝난 포즈를 쓰도록 스켈레탈 메시 틱 이후로 고정
+        UpdateSkinningTickGroup();
+        if (USkeletalMeshComponent* SkelComp = GetOwnerSkeletalMeshComponent())
+        {
+            PrimaryComponentTick.AddPrerequisite(SkelComp, SkelComp->PrimaryComponentTick);
+        }
+    }
+    SkinningCompletionTick.SetTickFunctionEnable(SkinningMode == ESkelToProcSkinningMode::Async);
+
     if (bConvertOnBeginPlay)
     {
         PrimaryComponentTick.bStartWithTickEnabled = true; 
@@ -26,365 +80,546 @@ void USkelToProcMeshComponent::BeginPlay()
     }
 }
 
+void USkelToProcMeshComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    // 워커가 스키닝 버퍼나 절단 요청을 쓰는 중일 수 있으므로 해제 전에 반드시 대기
+    PendingSkinningTask.Wait();
+    CancelPendingCut();
+    UpdatePieceStats(true);
+
+    // 풀에서 빌린 조각 컴포넌트는 풀 액터 소유라 액터와 함께 사라지지 않으므로 돌려줌
+    if (UProcMeshComponentPoolSubsystem* Pool = GetWorld() ? GetWorld()->GetSubsystem<UProcMeshComponentPoolSubsystem>() : nullptr)
+    {
+        for (const FSkelToProcMeshPiece& Piece : Pieces)
+        {
+            if (Pool->IsPooled(Piece.ProcMesh))
+            {
+                Pool->Release(Piece.ProcMesh);
+            }
+        }
+        if (Pool->IsPooled(FirstPieceMesh))
+        {
+            Pool->Release(FirstPieceMesh);
+            FirstPieceMesh = nullptr;
+        }
+        Pieces.Reset();
+    }
+
+    if (UProcMeshCutBudgetSubsystem* Budget = GetWorld() ? GetWorld()->GetSubsystem<UProcMeshCutBudgetSubsystem>() : nullptr)
+    {
+        Budget->UnregisterComponent(this);
+        Budget->RemoveQueuedCut(this);
+    }
+    Super::EndPlay(EndPlayReason);
+}
+
 void USkelToProcMeshComponent::TickComponent(float DeltaTime, ELevelTick TickType,
     FActorComponentTickFunction* ThisTickFunction)
 {
     Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-    UpdateProceduralMeshesSkinning();
-}
 
-bool USkelToProcMeshComponent::ConvertSkeletalMeshToProceduralMesh(bool bForceNewPMC, FName TargetBoneName)
-{
-    USkeletalMeshComponent* SkelComp = GetOwnerSkeletalMeshComponent();
-    if (!SkelComp || !SkelComp->GetSkeletalMeshAsset())
+    // 절단 후 레그돌로 전환되면 다음 프레임부터 물리 이후에 스키닝을 시작
+    if (SkinningMode != ESkelToProcSkinningMode::Synchronous && bEnableRuntimeSkinning && Pieces.Num() > 0)
     {
-        UE_LOG(LogTemp, Error, TEXT("SkelToProcMeshComponent: 유효하지 않은 Skeletal Mesh Component 또는 Asset입니다. 변환할 수 없습니다."));
-        return false;
+        UpdateSkinningTickGroup();
     }
 
-    
-    if (!SetupProceduralMeshComponent(bForceNewPMC))
+    // 예산 관리자가 이번 프레임 스키닝을 미뤘으면 스로틀 판정 없이 건너뜀
+    const bool bBudgetGranted = bSkinningGranted || !UProcMeshCutBudgetSubsystem::GetActive(GetWorld());
+    switch (bBudgetGranted ? EvaluateSkinningThrottle() : ESkelToProcSkinningThrottle::Skip)
     {
-        UE_LOG(LogTemp, Error, TEXT("SkelToProcMeshComponent: Procedural Mesh Component 설정에 실패했습니다. 변환할 수 없습니다."));
-        return false;
+    case ESkelToProcSkinningThrottle::Skin:
+        UpdateProceduralMeshesSkinning();
+        break;
+
+    case ESkelToProcSkinningThrottle::Interpolate:
+        // 새 스키닝 없이 직전 두 결과 사이를 보간해 업로드 (돌고 있던 작업이 있으면 먼저 회수)
+        INC_DWORD_STAT(STAT_ProcMeshSkinning_InterpolatedComponents);
+        CompleteAsyncSkinning();
+        UploadPresentedSkinning();
+        break;
+
+    case ESkelToProcSkinningThrottle::Skip:
+    default:
+        // 이미 돌고 있는 작업의 결과만 회수
+        INC_DWORD_STAT(STAT_ProcMeshSkinning_SkippedComponents);
+        if (PendingSkinningTask.IsValid())
+        {
+            CompleteAsyncSkinning();
+            UploadPresentedSkinning();
+        }
+        break;
     }
 
-    
-    ProceduralMeshComponent->SetWorldLocation(SkelComp->GetComponentLocation());
-    // ProceduralMeshComponent->SetWorldRotation(SkelComp->GetComponentRotation());
-    
-    // 원본 스켈레탈 메시의 역 바인드 포즈 행렬 가져오기
-    const FReferenceSkeleton& RefSkeleton = SkelComp->GetSkinnedAsset()->GetRefSkeleton();
-    const TArray<FTransform>& RefBonePose = RefSkeleton.GetRefBonePose();
-    
-    RefBoneInverseBindMatrices.Empty(RefBonePose.Num());
-    
-    for (const FTransform& BonePose : RefBonePose)
+    // 멈춘 채로 충분히 지났으면 정적 지오메트리로 굳힘 (틱도 여기서 꺼짐)
+    if (bSettleAtRest && bSkinningFrozenAtRest && GetWorld() && GetWorld()->GetTimeSeconds() - FrozenAtRestTime >= SettleDelay)
     {
-        // 컴포넌트 공간에서의 역 바인드 포즈 (스켈레탈 메시는 보통 본들이 루트에 대해 상대적으로 정의됨)
-        RefBoneInverseBindMatrices.Add(BonePose.ToMatrixWithScale().Inverse());
+        SettlePieces();
     }
-    // 데이터
-    // 복사 및 스키닝 정보 빌드
-    bool bSuccess = CopySkeletalLODToProcedural(SkelComp, TargetBoneName, LODIndexToCopy);
 
-    if(bSuccess)
+    // 틱하는 컴포넌트가 보유한 조각/스키닝 메모리를 프레임마다 합산 (STATS가 없는 빌드의 CSV 캡처용)
+    CSV_CUSTOM_STAT(AdvancedAction, PiecesAlive, TrackedNumPieces, ECsvCustomStatOp::Accumulate);
+    CSV_CUSTOM_STAT(AdvancedAction, SkinningDataKB, static_cast<float>(TrackedSkinningDataBytes / 1024.0), ECsvCustomStatOp::Accumulate);
+}
+
+void USkelToProcMeshComponent::UpdateSkinningTickGroup()
+{
+    // Pre-Physics에서 시작하면 레그돌은 지난 프레임 물리 포즈로 스키닝되므로, 시뮬레이션 중에는 물리 결과가 본에 반영된 뒤(End-Physics 이후) 시작.
+    // 결과 회수는 그대로 Post-Update-Work이므로 워커와 겹치는 구간만 줄어듦
+    const USkeletalMeshComponent* SkelComp = GetOwnerSkeletalMeshComponent();
+    const ETickingGroup DesiredTickGroup = SkelComp && SkelComp->IsSimulatingPhysics() ? TG_PostPhysics : TG_PrePhysics;
+    if (PrimaryComponentTick.TickGroup != DesiredTickGroup)
     {
-        UE_LOG(LogTemp, Log, TEXT("SkelToProcMeshComponent: 성공적으로 LOD %d의 Sekeltal Mesh를 Procedural Mesh로 변환 완료. 그리고 skinning data 구축 시작."), LODIndexToCopy);
-        if (bEnableRuntimeSkinning)
+        SetTickGroup(DesiredTickGroup);
+    }
+}
+
+void USkelToProcMeshComponent::RegisterComponentTickFunctions(bool bRegister)
+{
+    Super::RegisterComponentTickFunctions(bRegister);
+
+    if (bRegister)
+    {
+        if (SetupActorComponentTickFunction(&SkinningCompletionTick))
         {
-            PrimaryComponentTick.SetTickFunctionEnable(true); // 런타임 스키닝이 활성화되어 있으면 틱 시작
+            SkinningCompletionTick.Target = this;
+            SkinningCompletionTick.AddPrerequisite(this, PrimaryComponentTick);
         }
     }
-    else
+    else if (SkinningCompletionTick.IsTickFunctionRegistered())
     {
-        UE_LOG(LogTemp, Error, TEXT("SkelToProcMeshComponent: LOD %d의 스켈레탈 메쉬 변환 실패 또는 skinning data 구축 실패."), LODIndexToCopy);
+        SkinningCompletionTick.UnRegisterTickFunction();
     }
-    return bSuccess;
 }
 
+bool USkelToProcMeshComponent::ConvertSkeletalMeshToProceduralMesh(bool bForceNewPMC, FName TargetBoneName)
+{
+    return ConvertSkeletalMeshToProceduralMeshBatch(bForceNewPMC, { TargetBoneName });
+}
 
-bool USkelToProcMeshComponent::CopySkeletalLODToProcedural(USkeletalMeshComponent* SkelComp, FName TargetBoneName, int32 LODIndex)
+bool USkelToProcMeshComponent::ConvertSkeletalMeshToProceduralMeshBatch(bool bForceNewPMC, const TArray<FName>& TargetBoneNames)
 {
-    TArray<FVector> Vertices_Main;
-    TArray<FVector> Normals_Main;
-    TArray<FProcMeshTangent> Tangents_Main;
-    TArray<FVector2D> UV0_Main;
-    TArray<FLinearColor> VertexColors_Main;
-    TArray<int32> SectionMaterialIndices_Main;
-    TArray<TArray<int32>> SectionIndices_Main;
+    // 진행 중인 비동기 절단이 있으면 결과를 버리고 이번 요청으로 대체
+    CancelPendingCut();
 
-    OriginalToMainProcVertexMap.Empty(); // 멤버 변수 초기화
+    if (!BeginCut(bForceNewPMC, TargetBoneNames))
+    {
+        return false;
+    }
 
-    // GetFilteredSkeletalMeshDataByBoneName 호출하여 OriginalToMainProcVertexMap 채우기
-    bool bDataExtracted = GetFilteredSkeletalMeshDataByBoneName(
-        SkelComp, TargetBoneName, Threshold, LODIndex, // Threshold는 멤버 변수 사용
-        Vertices_Main, Normals_Main, Tangents_Main, UV0_Main, VertexColors_Main,
-        SectionMaterialIndices_Main, SectionIndices_Main,
-        OriginalToMainProcVertexMap); // 이 맵이 채워짐
+    // 지오메트리 단계를 게임 스레드에서 바로 실행
+    if (!CutRequest->bFromBakedData)
+    {
+        CutRequest->Run();
+    }
+    return FinishCut();
+}
 
-    if (!bDataExtracted)
+bool USkelToProcMeshComponent::ConvertSkeletalMeshToProceduralMeshAsync(bool bForceNewPMC, const TArray<FName>& TargetBoneNames)
+{
+    // 예산 관리자가 있으면 큐에 넣고, 실제 시작은 관리자가 프레임 예산 안에서 StartCutAsync로 함
+    if (UProcMeshCutBudgetSubsystem* Budget = UProcMeshCutBudgetSubsystem::GetActive(GetWorld()))
+    {
+        CancelPendingCut();
+        Budget->QueueCut(this, bForceNewPMC, TargetBoneNames);
+        bCutQueued = true;
+        return true;
+    }
+    return StartCutAsync(bForceNewPMC, TargetBoneNames);
+}
+
+bool USkelToProcMeshComponent::StartCutAsync(bool bForceNewPMC, const TArray<FName>& TargetBoneNames)
+{
+    CancelPendingCut();
+
+    if (!BeginCut(bForceNewPMC, TargetBoneNames))
     {
-        UE_LOG(LogTemp, Error, TEXT("CopySkeletalLODToProcedural: Failed to extract mesh data for TargetBone '%s'."), *TargetBoneName.ToString());
         return false;
     }
-    
-    // 노멀 재계산 (선택 사항, 기존 로직)
-    if (bRecalculateNormals && Vertices_Main.Num() > 0)
+
+    // 베이크된 결과는 마무리만 남았으므로 바로 끝냄
+    if (CutRequest->bFromBakedData)
+    {
+        FinishCut();
+        return true;
+    }
+
+    // 워커는 CutRequest만 읽고 쓰며, 컴포넌트는 CancelPendingCut/EndPlay에서 태스크가 끝날 때까지 대기한 뒤에만 요청을 다시 씀
+    FProcMeshCutRequest* Request = CutRequest.Get();
+    PendingCutTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [Request]()
+    {
+        Request->Run();
+    });
+
+    // 마무리(컴포넌트 생성, 원본 숨김, 델리게이트)는 게임 스레드에서. 그 사이 취소되었으면 CutSerial이 달라져 건너뜀
+    TWeakObjectPtr<USkelToProcMeshComponent> WeakThis(this);
+    const uint32 Serial = CutSerial;
+    UE::Tasks::Launch(UE_SOURCE_LOCATION, [WeakThis, Serial]()
     {
-        TArray<int32> AllIndices_Main;
-        for(const TArray<int32>& Indices : SectionIndices_Main) AllIndices_Main.Append(Indices);
-        if(AllIndices_Main.Num() > 0)
+        USkelToProcMeshComponent* This = WeakThis.Get();
+        if (This && This->bCutInProgress && This->CutSerial == Serial)
         {
-            UKismetProceduralMeshLibrary::CalculateTangentsForMesh(Vertices_Main, AllIndices_Main, UV0_Main, Normals_Main, Tangents_Main);
+            This->PendingCutTask = UE::Tasks::FTask();
+            This->FinishCut();
         }
+    }, UE::Tasks::Prerequisites(PendingCutTask), UE::Tasks::ETaskPriority::Normal, UE::Tasks::EExtendedTaskPriority::GameThreadNormalPri);
+
+    return true;
+}
+
+void USkelToProcMeshComponent::CancelPendingCut()
+{
+    // 워커가 CutRequest를 쓰는 중일 수 있으므로 먼저 대기하고, 예약된 게임 스레드 마무리는 CutSerial로 무효화
+    if (PendingCutTask.IsValid())
+    {
+        PendingCutTask.Wait();
+        PendingCutTask = UE::Tasks::FTask();
+    }
+    if (bCutInProgress)
+    {
+        bCutInProgress = false;
+        ++CutSerial;
     }
-    
-    // 메인 프로시저럴 메시 생성
-    for (int32 SectionIdx = 0; SectionIdx < SectionIndices_Main.Num(); ++SectionIdx)
+    if (bCutQueued)
     {
-        if (SectionIndices_Main[SectionIdx].Num() > 0)
+        bCutQueued = false;
+        if (UProcMeshCutBudgetSubsystem* Budget = GetWorld() ? GetWorld()->GetSubsystem<UProcMeshCutBudgetSubsystem>() : nullptr)
         {
-            ProceduralMeshComponent->CreateMeshSection_LinearColor(
-                SectionIdx, Vertices_Main, SectionIndices_Main[SectionIdx],
-                Normals_Main, UV0_Main, VertexColors_Main, Tangents_Main, false);
-
-            if (SectionMaterialIndices_Main.IsValidIndex(SectionIdx))
-            {
-                UMaterialInterface* Material = SkelComp->GetMaterial(SectionMaterialIndices_Main[SectionIdx]);
-                if (!Material && SkelComp->GetSkeletalMeshAsset()->GetMaterials().IsValidIndex(SectionMaterialIndices_Main[SectionIdx]))
-                {
-                    Material = SkelComp->GetSkeletalMeshAsset()->GetMaterials()[SectionMaterialIndices_Main[SectionIdx]].MaterialInterface;
-                }
-                if (Material) ProceduralMeshComponent->SetMaterial(SectionIdx, Material);
-            }
+            Budget->RemoveQueuedCut(this);
         }
     }
-    
-    MainProcMeshSkinningData.Empty();
-    if (!BuildSkinningDataForProceduralMesh(SkelComp, LODIndex, Vertices_Main, OriginalToMainProcVertexMap, MainProcMeshSkinningData))
+}
+
+bool USkelToProcMeshComponent::BeginCut(bool bForceNewPMC, TConstArrayView<FName> TargetBoneNames)
+{
+    SCOPE_CYCLE_COUNTER(STAT_ProcMeshCut_Begin);
+    TRACE_CPUPROFILER_EVENT_SCOPE(USkelToProcMeshComponent::BeginCut);
+
+    USkeletalMeshComponent* SkelComp = GetOwnerSkeletalMeshComponent();
+    if (!SkelComp || !SkelComp->GetSkeletalMeshAsset())
     {
-        UE_LOG(LogTemp, Warning, TEXT("CopySkeletalLODToProcedural: Failed to build skinning data for Main Procedural Mesh. Runtime skinning might not work."));
-        // 실패해도 절단은 계속 진행될 수 있도록 처리 (스키닝만 안됨)
+        UE_LOG(LogAdvancedAction, Error, TEXT("SkelToProcMeshComponent: 유효하지 않은 Skeletal Mesh Component 또는 Asset입니다. 변환할 수 없습니다."));
+        return false;
     }
 
-    
-    // --- 메쉬 슬라이스 및 OtherHalf 처리 ---
-    FVector BoneLocation = SkelComp->GetSocketLocation(TargetBoneName); // GetBoneLocation은 시뮬레이션 중인 본 위치를 줄 수 있음. 소켓 위치가 더 안정적일 수 있음.
-    UProceduralMeshComponent* TempOtherHalfMesh = nullptr; // 로컬 변수로 선언
+    if (TargetBoneNames.Num() == 0 || TargetBoneNames.Num() >= NoCutIndex)
+    {
+        UE_LOG(LogAdvancedAction, Error, TEXT("SkelToProcMeshComponent: 절단 본 수(%d)가 유효하지 않습니다. (1 ~ %d)"), TargetBoneNames.Num(), NoCutIndex - 1);
+        return false;
+    }
 
-    // SliceMesh 호출
-    UKismetProceduralMeshLibrary::SliceProceduralMesh(
-        ProceduralMeshComponent, BoneLocation, SkelComp->GetUpVector(), // 절단면 법선 (예: 본의 UpVector)
-        true, TempOtherHalfMesh, EProcMeshSliceCapOption::CreateNewSectionForCap, CapMaterialInterface);
+    USkeletalMesh* SkelMesh = SkelComp->GetSkeletalMeshAsset();
+    const int32 LODIndex = LODIndexToCopy;
 
-    OtherHalfProceduralMeshComponent = TempOtherHalfMesh; // 멤버 변수에 할당
-    
-    if (OtherHalfProceduralMeshComponent)
+    TArray<int32> TargetBoneIndices;
+    TargetBoneIndices.Reserve(TargetBoneNames.Num());
+    for (const FName& TargetBoneName : TargetBoneNames)
     {
-        // OtherHalf 메시도 SkelComp에 부착하거나 월드에 유지할지 결정. 여기서는 부착한다고 가정.
-        OtherHalfProceduralMeshComponent->AttachToComponent(SkelComp, FAttachmentTransformRules::KeepWorldTransform, OtherHalfMeshAttachSocketName);
-        OtherHalfProceduralMeshComponent->SetSimulatePhysics(false);
-        OtherHalfProceduralMeshComponent->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+        const int32 TargetBoneIndex = SkelComp->GetBoneIndex(TargetBoneName);
+        if (TargetBoneIndex == INDEX_NONE)
+        {
+            UE_LOG(LogAdvancedAction, Warning, TEXT("SkelToProcMeshComponent: TargetBone '%s' not found in SkeletalMesh."), *TargetBoneName.ToString());
+        }
+        TargetBoneIndices.Add(TargetBoneIndex);
+    }
 
-        // OtherHalf 메시에 대한 스키닝 정보 빌드는 복잡한 작업.
-        // SliceProceduralMesh는 버텍스를 새로 생성하고 인덱스를 변경할 수 있음.
-        // 가장 정확한 방법은 슬라이스된 OtherHalfProcMesh의 각 버텍스가
-        // 원본 스켈레탈 메쉬의 어떤 버텍스에 해당했는지 역추적하거나,
-        // 슬라이스 평면과의 관계를 이용해 스키닝 정보를 근사하는 것.
-        // 여기서는 OtherHalf의 스키닝 정보 빌드는 생략하고, 필요시 추가 구현.
-        // 만약 OtherHalf도 스키닝하려면, 해당 PMC의 버텍스 정보를 가져와서(GetProcMeshSection),
-        // 그 버텍스들이 MainPMC의 어떤 버텍스였는지 매핑하거나, 다시 원본 SkelMesh와 매핑해야 함.
-        UE_LOG(LogTemp, Log, TEXT("SliceMesh created OtherHalf. Skinning data for it is not built in this version."));
+    if (!CutRequest)
+    {
+        CutRequest = MakePimpl<FProcMeshCutRequest>();
     }
-    else
+
+    // 메시/LOD/옵션이 맞는 베이크 에셋이 있으면 지오메트리 단계 없이 결과를 바로 채움
+    CutRequest->bFromBakedData = BakedCutData
+        && BakedCutData->Matches(SkelMesh, LODIndex, Threshold, bCutBoneSubtree, bRecalculateNormals, bCopyVertexColors)
+        && BakedCutData->BuildCutResult(TargetBoneNames, CutRequest->Result);
+    CutRequest->bSucceeded = CutRequest->bFromBakedData;
+    if (BakedCutData && !CutRequest->bFromBakedData)
     {
-        UE_LOG(LogTemp, Warning, TEXT("SliceMesh did not create OtherHalf for bone '%s'."), *TargetBoneName.ToString());
+        UE_LOG(LogAdvancedAction, Log, TEXT("SkelToProcMeshComponent: 베이크 에셋 '%s'을(를) 이 절단에 쓸 수 없어 런타임에 생성합니다."), *BakedCutData->GetName());
     }
 
-    // --- 원본 메쉬 숨기기, PMC 부착, 레그돌 (기존 로직) ---
-    HideOriginalMeshVerticesByBone(SkelComp, LODIndex, TargetBoneName);
+    FProcMeshCutSettings& Settings = CutRequest->Settings;
+    if (!CutRequest->bFromBakedData && !Settings.Init(*SkelMesh, LODIndex, TargetBoneIndices, bCutBoneSubtree))
+    {
+        UE_LOG(LogAdvancedAction, Error, TEXT("SkelToProcMeshComponent: LOD %d의 렌더 데이터 사본 또는 인플루언스 색인을 만들 수 없습니다."), LODIndex);
+        return false;
+    }
+    Settings.MinWeight = Threshold;
+    Settings.bCopyVertexColors = bCopyVertexColors;
+    Settings.bRecalculateNormals = bRecalculateNormals;
+    Settings.bCreateCap = true;
+
+    CutBoneNames = TargetBoneNames;
+    CutLODIndex = LODIndex;
+    bCutForceNewPMC = bForceNewPMC;
+    bCutInProgress = true;
+    ++CutSerial;
+    return true;
+}
 
-    ProceduralMeshComponent->SetSimulatePhysics(false);
-    ProceduralMeshComponent->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
-    if (!ProceduralMeshAttachSocketName.IsNone() && SkelComp->DoesSocketExist(ProceduralMeshAttachSocketName))
+bool USkelToProcMeshComponent::FinishCut()
+{
+    bCutInProgress = false;
+
+    const bool bSuccess = CreatePiecesFromCutResult();
+    if (bSuccess)
     {
-        ProceduralMeshComponent->AttachToComponent(SkelComp, FAttachmentTransformRules::KeepWorldTransform, ProceduralMeshAttachSocketName);
+        UE_LOG(LogAdvancedAction, Log, TEXT("SkelToProcMeshComponent: 성공적으로 LOD %d의 Sekeltal Mesh를 Procedural Mesh로 변환 완료 (본 %d개, 조각 %d개). 그리고 skinning data 구축 시작."), CutLODIndex, CutBoneNames.Num(), Pieces.Num());
+        if (bEnableRuntimeSkinning)
+        {
+            PrimaryComponentTick.SetTickFunctionEnable(true); // 런타임 스키닝이 활성화되어 있으면 틱 시작
+            SkinningCompletionTick.SetTickFunctionEnable(SkinningMode == ESkelToProcSkinningMode::Async); // SettlePieces로 꺼졌을 수 있음
+        }
+        if (UProcMeshCutBudgetSubsystem* Budget = UProcMeshCutBudgetSubsystem::GetActive(GetWorld()))
+        {
+            Budget->RegisterComponent(this);
+        }
     }
     else
     {
-         ProceduralMeshComponent->AttachToComponent(SkelComp, FAttachmentTransformRules::KeepWorldTransform, TargetBoneName); // 폴백
-         UE_LOG(LogTemp, Warning, TEXT("ProceduralMeshAttachSocketName invalid or not found, attaching to TargetBoneName: %s"), *TargetBoneName.ToString());
+        UE_LOG(LogAdvancedAction, Error, TEXT("SkelToProcMeshComponent: LOD %d의 스켈레탈 메쉬 변환 실패 또는 skinning data 구축 실패."), CutLODIndex);
     }
-    
-    SkelComp->SetCollisionProfileName(TEXT("Ragdoll"));
-    SkelComp->SetSimulatePhysics(true);
-    // SkelComp->AddImpulseAtLocation(...) 또는 BreakConstraint
-    SkelComp->BreakConstraint(SkelComp->GetRightVector() * ImpulseMagnitude, BoneLocation, TargetBoneName); // 예시 임펄스
 
-    return true;
+    OnCutCompleted.Broadcast(bSuccess);
+    return bSuccess;
 }
 
+TArray<UMeshComponent*> USkelToProcMeshComponent::GetPieceMeshes() const
+{
+    TArray<UMeshComponent*> PieceMeshes;
+    PieceMeshes.Reserve(Pieces.Num());
+    for (const FSkelToProcMeshPiece& Piece : Pieces)
+    {
+        if (Piece.ProcMesh)
+        {
+            PieceMeshes.Add(Piece.ProcMesh);
+        }
+    }
+    return PieceMeshes;
+}
 
-bool USkelToProcMeshComponent::GetFilteredSkeletalMeshDataByBoneName(const USkeletalMeshComponent* SkelComp, FName TargetBoneName, float MinWeight, int32 LODIndex, TArray<FVector>& OutVertices,
-    TArray<FVector>& OutNormals, TArray<FProcMeshTangent>& OutTangents, TArray<FVector2D>& OutUV0, TArray<FLinearColor>& OutVertexColors,
-    TArray<int32>& OutSectionMaterialIndices, TArray<TArray<int32>>& OutSectionIndices, TMap<uint32, uint32>& OutOriginalToProcVertexMap)
+TArray<UProceduralMeshComponent*> USkelToProcMeshComponent::GetPieceProceduralMeshes() const
 {
-    // 0. 필수 컴포넌트 및 데이터 유효성 검사
-    if (!SkelComp || !SkelComp->GetSkeletalMeshAsset() || !SkelComp->GetSkeletalMeshAsset()->GetResourceForRendering()) return false;
-    
-    FSkeletalMeshRenderData* RenderData = SkelComp->GetSkeletalMeshAsset()->GetResourceForRendering();
-    if (!RenderData || !RenderData->LODRenderData.IsValidIndex(LODIndex)) // LOD 인덱스 유효성 검사
+    return TArray<UProceduralMeshComponent*>();
+}
+
+UProcMeshPieceComponent* USkelToProcMeshComponent::AcquirePieceProceduralMesh(TArray<TObjectPtr<UProcMeshPieceComponent>>& ReusableProcMeshes)
+{
+    // 이전 변환에서 쓰던 조각 컴포넌트가 있으면 파괴/생성 대신 섹션만 비우고 재사용
+    while (ReusableProcMeshes.Num() > 0)
     {
-        UE_LOG(LogTemp, Warning, TEXT("GetFilteredSkeletalMeshDataByBoneName : LODRenderData[%d]이 유효하지 않습니다."), LODIndex);
-        return false; 
+        UProcMeshPieceComponent* Reused = ReusableProcMeshes.Pop(EAllowShrinking::No);
+        if (IsValid(Reused))
+        {
+            Reused->ClearAllMeshSections();
+            return Reused;
+        }
     }
-    
-    FSkeletalMeshLODRenderData& LODRenderData = RenderData->LODRenderData[LODIndex];
 
-    int32 FoundTargetBoneIndex = SkelComp->GetBoneIndex(TargetBoneName); // TargetBoneName에 대한 실제 본 인덱스
-    if (TargetBoneName != NAME_None && FoundTargetBoneIndex == INDEX_NONE)
+    // 월드 풀이 있으면 미리 등록된 컴포넌트를 빌림
+    if (UProcMeshComponentPoolSubsystem* Pool = UProcMeshComponentPoolSubsystem::GetActive(GetWorld()))
     {
-        UE_LOG(LogTemp, Warning, TEXT("GetFilteredSkeletalMeshDataByBoneName: TargetBone '%s' not found in SkeletalMesh."), *TargetBoneName.ToString());
-        // TargetBoneName이 지정되었으나 찾을 수 없는 경우, 필터링 없이 진행할지 여부 결정 필요. 여기서는 필터링 실패로 간주 가능.
-        // 또는 모든 버텍스를 가져오도록 bShouldFilter = false 처리. 여기서는 지정된 본이 없으면 실패로 가정하지 않음 (모든 버텍스 대상 가능)
+        if (UProcMeshPieceComponent* Pooled = Pool->Acquire())
+        {
+            return Pooled;
+        }
     }
 
-    const FSkinWeightVertexBuffer* SkinWeightBufferPtr = LODRenderData.GetSkinWeightVertexBuffer();
-    if (!SkinWeightBufferPtr || SkinWeightBufferPtr->GetNumVertices() == 0)
+    UProcMeshPieceComponent* NewProcMesh = NewObject<UProcMeshPieceComponent>(FirstPieceMesh->GetOuter(), NAME_None, RF_Transient);
+    NewProcMesh->RegisterComponent();
+    return NewProcMesh;
+}
+
+void USkelToProcMeshComponent::ReleasePieceProceduralMesh(UProcMeshPieceComponent* ProcMesh)
+{
+    if (!IsValid(ProcMesh))
+    {
+        return;
+    }
+
+    // 풀 비활성화 이후에도 풀에서 빌린 컴포넌트는 풀로 돌려줌 (풀 소유가 아니면 Release가 파괴)
+    if (UProcMeshComponentPoolSubsystem* Pool = GetWorld() ? GetWorld()->GetSubsystem<UProcMeshComponentPoolSubsystem>() : nullptr)
     {
-        UE_LOG(LogTemp, Error, TEXT("GetFilteredSkeletalMeshDataByBoneName: SkinWeightVertexBuffer is invalid or empty for LOD %d."), LODIndex);
-        return false; 
+        Pool->Release(ProcMesh);
+        return;
     }
-    
-    OutOriginalToProcVertexMap.Empty(); // 맵 초기화
-    uint32 CurrentProcVertexIndex = 0;
+    ProcMesh->DestroyComponent();
+}
 
-    // 임시: 버텍스 컬러 기본값 설정 (bCopyVertexColors 로직은 유지)
-    FLinearColor DefaultColor = FLinearColor::White;
-    
-    // --- 정적 버퍼 가져오기 (노멀, 탄젠트, UV, 컬러) ---
-    // 참고: 이들은 일반적으로 *기본* 메쉬의 데이터이며, 나중에 bRecalculateNormals가 true가 아닌 이상 프레임마다 동적으로 재계산되지 않습니다.
-    FStaticMeshVertexBuffers& StaticVertexBuffers = LODRenderData.StaticVertexBuffers;
-    uint32 NumVertices = StaticVertexBuffers.PositionVertexBuffer.GetNumVertices(); // 버텍스 수 가져오기
 
-    // 버퍼 크기 적절하게 조정
-    //OutNormals.SetNumUninitialized(NumVertices);
-    //OutTangents.SetNumUninitialized(NumVertices);
-    //OutUV0.SetNumUninitialized(NumVertices);
-    
-    if (bCopyVertexColors && StaticVertexBuffers.ColorVertexBuffer.IsInitialized())
+bool USkelToProcMeshComponent::CreatePiecesFromCutResult()
+{
+    SCOPE_CYCLE_COUNTER(STAT_ProcMeshCut_CreatePieces);
+    TRACE_CPUPROFILER_EVENT_SCOPE(USkelToProcMeshComponent::CreatePiecesFromCutResult);
+    CSV_SCOPED_TIMING_STAT(AdvancedAction, CutCreatePieces);
+
+    USkeletalMeshComponent* SkelComp = GetOwnerSkeletalMeshComponent();
+    if (!SkelComp || !CutRequest || !CutRequest->bSucceeded)
     {
-        // 버텍스 컬러 복사 옵션이 켜져 있고 컬러 버퍼가 초기화된 경우 크기 설정
-        OutVertexColors.SetNumUninitialized(NumVertices);
+        return false;
     }
-    else
+
+    if (!SetupProceduralMeshComponent(bCutForceNewPMC))
     {
-        // 그렇지 않으면 버텍스 컬러 배열 비우기
-        OutVertexColors.Empty();
+        UE_LOG(LogAdvancedAction, Error, TEXT("SkelToProcMeshComponent: Procedural Mesh Component 설정에 실패했습니다. 변환할 수 없습니다."));
+        return false;
     }
-    
-    for (const FSkelMeshRenderSection& Section : LODRenderData.RenderSections)
+
+    // 이전 조각을 스키닝 중인 워커가 있으면 버퍼를 다시 빌드하기 전에 끝낸다
+    PendingSkinningTask.Wait();
+    PendingSkinningTask = UE::Tasks::FTask();
+    ActiveSkinningJobs.Reset();
+
+    // 새 조각은 다음 틱에 바로 스키닝하고, 이전 조각 결과에서 보간하지 않음
+    bResetSkinningHistory = true;
+    bSkinningFrozenAtRest = false;
+    bSettled = false;
+    SkinningFrameCounter = FMath::Max(MaxSkinningInterval, 1);
+
+    FirstPieceMesh->SetWorldLocation(SkelComp->GetComponentLocation());
+    // FirstPieceMesh->SetWorldRotation(SkelComp->GetComponentRotation());
+
+    // 원본 스켈레탈 메시의 역 바인드 포즈 행렬 가져오기
+    // 에셋이 이미 컴포넌트 공간 기준으로 계산해 두므로 본마다 다시 역행렬을 구하지 않고 그대로 복사 (절단당 한 번)
+    RefBoneInverseBindMatrices = SkelComp->GetSkeletalMeshAsset()->GetRefBasesInvMatrix();
+
+    FProcMeshCutResult& Result = CutRequest->Result;
+    const int32 LODIndex = CutLODIndex;
+
+    auto GetSectionMaterial = [&](int32 SectionIdx, const FProcMeshSliceHalf& Half) -> UMaterialInterface*
     {
-        const uint32 SectionBaseVertexIndex = Section.BaseVertexIndex;
+        if (SectionIdx == Half.CapSectionIndex)
+        {
+            return CapMaterialInterface;
+        }
+        if (!Result.SectionMaterialIndices.IsValidIndex(SectionIdx))
         {
-            for (uint32 i = 0; i < Section.NumVertices; ++i)
+            return nullptr;
+        }
+        UMaterialInterface* Material = SkelComp->GetMaterial(Result.SectionMaterialIndices[SectionIdx]);
+        if (!Material && SkelComp->GetSkeletalMeshAsset()->GetMaterials().IsValidIndex(Result.SectionMaterialIndices[SectionIdx]))
+        {
+            Material = SkelComp->GetSkeletalMeshAsset()->GetMaterials()[Result.SectionMaterialIndices[SectionIdx]].MaterialInterface;
+        }
+        return Material;
+    };
+
+    // 섹션마다 자기 삼각형이 참조하는 버텍스만 올리고, 섹션 버텍스 -> 절반 버텍스 리맵을 섹션 순서로 이어 붙여 스키닝 스트림 순서로 씀
+    FProcMeshGeometry SectionGeometry;
+    TArray<int32> SourceToSection;
+    TArray<int32> SectionVertexIndices;
+    TArray<int32> StreamVertexIndices;
+    auto CreateSectionsFromHalf = [&](FSkelToProcMeshPiece& Piece, const FProcMeshSliceHalf& Half)
+    {
+        UProcMeshPieceComponent* PieceMesh = Piece.ProcMesh;
+        const FProcMeshGeometry& Geometry = Half.Geometry;
+        SourceToSection.Reset();
+        StreamVertexIndices.Reset();
+        PieceMesh->ResetSkinnedFrames(); // 재사용된 컴포넌트의 이전 조각 프레임 제거
+        Piece.SectionVertexOffsets.SetNumUninitialized(Geometry.SectionIndices.Num() + 1);
+        for (int32 SectionIdx = 0; SectionIdx < Geometry.SectionIndices.Num(); ++SectionIdx)
+        {
+            Piece.SectionVertexOffsets[SectionIdx] = StreamVertexIndices.Num();
+            if (Geometry.SectionIndices[SectionIdx].Num() > 0)
             {
-                const uint32 OriginalSkelVertexIndex = SectionBaseVertexIndex + i;
-                if (GetBoneWeightForVertex(OriginalSkelVertexIndex, FoundTargetBoneIndex, &Section, &LODRenderData, SkinWeightBufferPtr) > Threshold)
+                Geometry.ExtractSection(SectionIdx, SectionGeometry, SectionVertexIndices, SourceToSection);
+                StreamVertexIndices.Append(SectionVertexIndices);
+                PieceMesh->CreateMeshSection_LinearColor(
+                    SectionIdx, SectionGeometry.Vertices, SectionGeometry.SectionIndices[0],
+                    SectionGeometry.Normals, SectionGeometry.UV0, SectionGeometry.VertexColors, SectionGeometry.Tangents);
+
+                if (UMaterialInterface* Material = GetSectionMaterial(SectionIdx, Half))
                 {
-                    // Vertex 처리
-                    const FVector SkinnedVectorPosition = FVector(StaticVertexBuffers.PositionVertexBuffer.VertexPosition(OriginalSkelVertexIndex));
-                    OutVertices.Add(SkinnedVectorPosition);
-                    
-                    // Normal, 버퍼 유형에 따라 FPackedNormal/FVector3f 변환 필요
-                    const FVector Normal = FVector(StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentZ(OriginalSkelVertexIndex)); // Z는 노멀 포함
-                    OutNormals.Add(Normal);
-                    
-                    // 외적과 부호를 사용하여 바이노멀(TangentY) 계산
-                    // FVector TangentY = FVector::CrossProduct(Normal, TangentX) * TangentSign;
-                    // CreateMeshSection용 FProcMeshTangent에는 TangentY를 직접 저장하지 않지만, Normal과 TangentX로부터 파생됨
-                    const FVector TangentX = FVector(StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentX(OriginalSkelVertexIndex)); // X는 탄젠트 포함
-                    auto ProcMeshTangent = FProcMeshTangent(TangentX, false);
-                    ProcMeshTangent.TangentX = TangentX;
-                    OutTangents.Add(ProcMeshTangent);
-                    
-                    // UV (단순화를 위해 UV 채널 1개만 가정)
-                    // 버퍼 유형에 따라 FVector2f 변환 필요
-                    const FVector2D VertexUV = FVector2D(StaticVertexBuffers.StaticMeshVertexBuffer.GetVertexUV(OriginalSkelVertexIndex, 0));
-                    OutUV0.Add(VertexUV);
-                    
-                    // FilteredVertexIndexMap 업데이트
-                    OutOriginalToProcVertexMap.Add(OriginalSkelVertexIndex, CurrentProcVertexIndex);
-                    CurrentProcVertexIndex += 1;
+                    PieceMesh->SetMaterial(SectionIdx, Material);
                 }
             }
         }
-    }
-    
-    // --- 인덱스 재구성 단계 (섹션 구조 유지) ---
-    // 원본 인덱스 버퍼 데이터 가져오기
-    TArray<uint32> GlobalIndexBuffer;
-    LODRenderData.MultiSizeIndexContainer.GetIndexBuffer(GlobalIndexBuffer);
+        Piece.SectionVertexOffsets.Last() = StreamVertexIndices.Num();
+    };
 
-    const int32 NumSections = LODRenderData.RenderSections.Num();
-    OutSectionIndices.Empty(NumSections);
-    OutSectionIndices.SetNum(NumSections);
-    OutSectionMaterialIndices.Empty(NumSections);
-    OutSectionMaterialIndices.SetNum(NumSections);
-    
-    for (int32 SectionIdx = 0; SectionIdx < NumSections; ++SectionIdx)
+    // 조각 배치. 스키닝 결과는 SkelComp 컴포넌트 공간이므로 런타임 스키닝 중에는 로컬 공간이 일치하도록 SkelComp 자체에 스냅
+    auto AttachPiece = [&](const FSkelToProcMeshPiece& Piece)
     {
-        const FSkelMeshRenderSection& Section = LODRenderData.RenderSections[SectionIdx];
-        OutSectionMaterialIndices[SectionIdx] = Section.MaterialIndex;
-        TArray<int32>& CurrentSectionIndices = OutSectionIndices[SectionIdx];
-        CurrentSectionIndices.Empty(Section.NumTriangles * 3);
-
-        for (uint32 TriIdx = 0; TriIdx < Section.NumTriangles; ++TriIdx)
+        UMeshComponent* ProcMesh = Piece.ProcMesh;
+        ProcMesh->SetSimulatePhysics(false);
+        ProcMesh->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+        if (bEnableRuntimeSkinning)
         {
-            uint32 OriginalVIdx0 = GlobalIndexBuffer[Section.BaseIndex + TriIdx * 3 + 0];
-            uint32 OriginalVIdx1 = GlobalIndexBuffer[Section.BaseIndex + TriIdx * 3 + 1];
-            uint32 OriginalVIdx2 = GlobalIndexBuffer[Section.BaseIndex + TriIdx * 3 + 2];
-
-            const uint32* ProcVIdx0Ptr = OutOriginalToProcVertexMap.Find(OriginalVIdx0);
-            const uint32* ProcVIdx1Ptr = OutOriginalToProcVertexMap.Find(OriginalVIdx1);
-            const uint32* ProcVIdx2Ptr = OutOriginalToProcVertexMap.Find(OriginalVIdx2);
-
-            if (ProcVIdx0Ptr && ProcVIdx1Ptr && ProcVIdx2Ptr) // 세 버텍스 모두 필터링을 통과했으면
-            {
-                CurrentSectionIndices.Add(*ProcVIdx0Ptr);
-                CurrentSectionIndices.Add(*ProcVIdx1Ptr);
-                CurrentSectionIndices.Add(*ProcVIdx2Ptr);
-            }
+            ProcMesh->AttachToComponent(SkelComp, FAttachmentTransformRules::SnapToTargetIncludingScale);
         }
-    }
-    bool bFoundAnyTriangles = false;
-    for(const auto& Indices : OutSectionIndices)
+        else if (Piece.bIsOtherHalf)
+        {
+            ProcMesh->AttachToComponent(SkelComp, FAttachmentTransformRules::KeepWorldTransform, OtherHalfMeshAttachSocketName);
+        }
+        else if (!ProceduralMeshAttachSocketName.IsNone() && SkelComp->DoesSocketExist(ProceduralMeshAttachSocketName))
+        {
+            ProcMesh->AttachToComponent(SkelComp, FAttachmentTransformRules::KeepWorldTransform, ProceduralMeshAttachSocketName);
+        }
+        else
+        {
+            ProcMesh->AttachToComponent(SkelComp, FAttachmentTransformRules::KeepWorldTransform, Piece.SourceBoneName); // 폴백
+            UE_LOG(LogAdvancedAction, Verbose, TEXT("ProceduralMeshAttachSocketName invalid or not found, attaching to TargetBoneName: %s"), *Piece.SourceBoneName.ToString());
+        }
+    };
+
+    // 이전 조각의 컴포넌트는 재사용 후보로 돌림 (첫 조각 컴포넌트 제외)
+    TArray<TObjectPtr<UProcMeshPieceComponent>> ReusableProcMeshes;
+    for (int32 PieceIdx = Pieces.Num() - 1; PieceIdx >= 0; --PieceIdx)
     {
-        if (Indices.Num() > 0)
+        if (Pieces[PieceIdx].ProcMesh && Pieces[PieceIdx].ProcMesh != FirstPieceMesh)
         {
-            bFoundAnyTriangles = true;
-            break;
+            ReusableProcMeshes.Add(Pieces[PieceIdx].ProcMesh);
         }
     }
-    if (!bFoundAnyTriangles && OutVertices.Num() > 0)
+    Pieces.Reset();
+
+    for (FProcMeshCutPieceData& PieceData : Result.Pieces)
     {
-        UE_LOG(LogTemp, Warning, TEXT("GetFilteredSkeletalMeshDataByBoneName: No triangles remained after filtering for TargetBone '%s'."), *TargetBoneName.ToString());
+        FSkelToProcMeshPiece& Piece = Pieces.AddDefaulted_GetRef();
+        Piece.SourceBoneName = CutBoneNames[PieceData.CutIndex];
+        Piece.CutIndex = PieceData.CutIndex;
+        Piece.bIsOtherHalf = PieceData.bIsOtherHalf;
+        if (Pieces.Num() == 1)
+        {
+            Piece.ProcMesh = FirstPieceMesh;
+        }
+        else
+        {
+            Piece.ProcMesh = AcquirePieceProceduralMesh(ReusableProcMeshes);
+            Piece.ProcMesh->SetWorldTransform(FirstPieceMesh->GetComponentTransform());
+        }
+
+        CreateSectionsFromHalf(Piece, PieceData.Half);
+        Piece.SkinningData.InitFromRemap(PieceData.SkinningData, StreamVertexIndices); // 섹션 경계 버텍스는 섹션마다 한 번씩 스키닝
+        AttachPiece(Piece);
     }
-    return OutVertices.Num() > 0 && bFoundAnyTriangles; // 버텍스와 트라이앵글이 모두 있어야 성공
-}
 
-bool USkelToProcMeshComponent::SliceMesh(UProceduralMeshComponent* InProcMesh, FVector PlanePosition, FVector PlaneNormal, bool bCreateOtherHalf, UProceduralMeshComponent*& OutOtherHalfProcMesh,
-    EProcMeshSliceCapOption CapOption, UMaterialInterface* CapMaterial)
-{
-    UKismetProceduralMeshLibrary::SliceProceduralMesh(InProcMesh, PlanePosition, PlaneNormal, bCreateOtherHalf, OutOtherHalfProcMesh, CapOption, CapMaterial);
-    if (OutOtherHalfProcMesh != nullptr)
+    // 이번 변환에서 쓰이지 않은 이전 조각 컴포넌트는 풀로 돌려줌
+    for (UProcMeshPieceComponent* Unused : ReusableProcMeshes)
     {
-        return true;
+        ReleasePieceProceduralMesh(Unused);
     }
-    return false;
-}
 
-float USkelToProcMeshComponent::GetBoneWeightForVertex(int32 VertexIndex, int32 TargetBoneIndex, const FSkelMeshRenderSection* SkelMeshRenderSection, const FSkeletalMeshLODRenderData* LODRenderData,
-    const FSkinWeightVertexBuffer* SkinWeightBuffer)
-{
-    if (!SkinWeightBuffer || SkinWeightBuffer->GetNumVertices() == 0) return -1.f;
-    const int32 MaxInfluences = SkinWeightBuffer->GetMaxBoneInfluences();
-    const TArray<FBoneIndexType>& BoneMap = SkelMeshRenderSection->BoneMap;
-    for (int32 InfluenceIdx = 0; InfluenceIdx < MaxInfluences; InfluenceIdx++)
+    UpdatePieceStats(false);
+
+    // 리맵 테이블은 컴포넌트가 보관 (GetOriginalToProcVertexIndices 등)
+    OriginalToProcVertexIndices = MoveTemp(Result.OriginalToProcVertexIndices);
+    OriginalToCutIndices = MoveTemp(Result.OriginalToCutIndices);
+    CutProcToOriginalVertexIndices = MoveTemp(Result.ProcToOriginalVertexIndices);
+
+    // --- 원본 메쉬 숨기기 (모든 절단을 모아 오버라이드 한 번), 레그돌 ---
+    HideOriginalMeshVertices(SkelComp, LODIndex, OriginalToCutIndices);
+
+    SkelComp->SetCollisionProfileName(TEXT("Ragdoll"));
+    SkelComp->SetSimulatePhysics(true);
+    // SkelComp->AddImpulseAtLocation(...) 또는 BreakConstraint
+    for (const FName& TargetBoneName : CutBoneNames)
     {
-        int32 LocalBoneIndex = SkinWeightBuffer->GetBoneIndex(VertexIndex, InfluenceIdx);
-        if (LocalBoneIndex >= BoneMap.Num()) continue; // Ensure we are within bounds
-        
-        int32 GlobalBoneIndex = BoneMap[LocalBoneIndex];
-        float BoneWeight = SkinWeightBuffer->GetBoneWeight(VertexIndex, InfluenceIdx) / 65535.0f;
-        
-        if (GlobalBoneIndex == TargetBoneIndex && BoneWeight > 0)
-        {
-            return BoneWeight;
-        }
+        const FVector BoneLocation = SkelComp->GetSocketLocation(TargetBoneName);
+        SkelComp->BreakConstraint(SkelComp->GetRightVector() * ImpulseMagnitude, BoneLocation, TargetBoneName); // 예시 임펄스
     }
-    return -1.f;
+
+    return Pieces.Num() > 0;
 }
 
 USkeletalMeshComponent* USkelToProcMeshComponent::GetOwnerSkeletalMeshComponent() const
@@ -392,400 +627,455 @@ USkeletalMeshComponent* USkelToProcMeshComponent::GetOwnerSkeletalMeshComponent(
     AActor* Owner = GetOwner();
     if (!Owner)
     {
-        UE_LOG(LogTemp, Warning, TEXT("SkelToProcMeshComponent: Owner를 찾을 수 없습니다."));
+        UE_LOG(LogAdvancedAction, Warning, TEXT("SkelToProcMeshComponent: Owner를 찾을 수 없습니다."));
         return nullptr;
     }
     USkeletalMeshComponent* SkelComp = Owner->FindComponentByClass<USkeletalMeshComponent>();
     if (!SkelComp)
     {
-        UE_LOG(LogTemp, Warning, TEXT("SkelToProcMeshComponent: Owner '%s'에 SkeletalMeshComponent가 없습니다."), *Owner->GetName());
+        UE_LOG(LogAdvancedAction, Warning, TEXT("SkelToProcMeshComponent: Owner '%s'에 SkeletalMeshComponent가 없습니다."), *Owner->GetName());
         return nullptr;
     }
     if (!SkelComp->GetSkeletalMeshAsset())
     {
-        UE_LOG(LogTemp, Warning, TEXT("SkelToProcMeshComponent: '%s'의 SkeletalMeshComponent에 Skeletal Mesh Asset이 할당되지 않았습니다."), *Owner->GetName());
+        UE_LOG(LogAdvancedAction, Warning, TEXT("SkelToProcMeshComponent: '%s'의 SkeletalMeshComponent에 Skeletal Mesh Asset이 할당되지 않았습니다."), *Owner->GetName());
         return nullptr;
     }
     return SkelComp;
 }
 
-bool USkelToProcMeshComponent::HideOriginalMeshVerticesByBone(USkeletalMeshComponent* SourceSkeletalMeshComp, int32 LODIndex, FName TargetBoneName, bool bClearOverride)
+bool USkelToProcMeshComponent::HideOriginalMeshVertices(USkeletalMeshComponent* SourceSkeletalMeshComp, int32 LODIndex, TConstArrayView<uint8> InOriginalToCutIndices, bool bClearOverride)
 {
-    if (!SourceSkeletalMeshComp || !SourceSkeletalMeshComp->GetSkeletalMeshAsset())
-    {
-        UE_LOG(LogTemp, Warning, TEXT("HideOriginalMeshVerticesByBone: Invalid Skeletal Mesh Component or Asset."));
-        return false;
-    }
-
-    USkeletalMesh* SkelMesh = SourceSkeletalMeshComp->GetSkeletalMeshAsset();
-    const FReferenceSkeleton& RefSkeleton = SkelMesh->GetRefSkeleton();
-    int32 TargetBoneIndex = RefSkeleton.FindBoneIndex(TargetBoneName);
+    SCOPE_CYCLE_COUNTER(STAT_ProcMeshCut_Hide);
+    TRACE_CPUPROFILER_EVENT_SCOPE(USkelToProcMeshComponent::HideOriginalMeshVertices);
 
-    if (TargetBoneIndex == INDEX_NONE)
+    if (!SourceSkeletalMeshComp || !SourceSkeletalMeshComp->GetSkeletalMeshAsset())
     {
-        UE_LOG(LogTemp, Warning, TEXT("HideOriginalMeshVerticesByBone: Bone '%s' not found."), *TargetBoneName.ToString());
+        UE_LOG(LogAdvancedAction, Warning, TEXT("HideOriginalMeshVertices: Invalid Skeletal Mesh Component or Asset."));
         return false;
     }
 
     // FSkeletalMeshRenderData 접근은 게임 스레드에서 직접 하면 위험할 수 있으나, 읽기 목적 및 컴포넌트 상태 기반이므로
     // 일부 상황에서는 가능할 수 있습니다. 복잡한 경우 렌더 스레드 접근 고려.
     FSkeletalMeshRenderData* SkelRenderData = SourceSkeletalMeshComp->GetSkeletalMeshRenderData();
-    if (!SkelRenderData || SkelRenderData->LODRenderData[LODIndex].GetNumVertices() == 0)
+    if (!SkelRenderData || !SkelRenderData->LODRenderData.IsValidIndex(LODIndex))
     {
-         UE_LOG(LogTemp, Warning, TEXT("HideOriginalMeshVerticesByBone: Invalid LOD Index %d."), LODIndex);
+         UE_LOG(LogAdvancedAction, Warning, TEXT("HideOriginalMeshVertices: Invalid LOD Index %d."), LODIndex);
         return false;
     }
 
     FSkeletalMeshLODRenderData& LODRenderData = SkelRenderData->LODRenderData[LODIndex];
-    FSkinWeightVertexBuffer* SkinWeightBuffer = SourceSkeletalMeshComp->GetSkinWeightBuffer(LODIndex); // 인스턴스별 버퍼 가져오기
-
-    if (!SkinWeightBuffer)
-    {
-         UE_LOG(LogTemp, Warning, TEXT("HideOriginalMeshVerticesByBone: Could not get SkinWeightVertexBuffer for LOD %d."), LODIndex);
-        return false;
-    }
 
-    uint32 NumVertices = LODRenderData.GetNumVertices();
-    if (NumVertices == 0)
+    if (LODRenderData.GetNumVertices() == 0)
     {
-        UE_LOG(LogTemp, Warning, TEXT("HideOriginalMeshVerticesByBone: LOD %d has no vertices."), LODIndex);
+        UE_LOG(LogAdvancedAction, Warning, TEXT("HideOriginalMeshVertices: LOD %d has no vertices."), LODIndex);
         return false;
     }
 
-    TArray<int32> VerticesToHideIndices;
-    VerticesToHideIndices.Reserve(NumVertices / 4); // 예상 크기 예약
-
-    // 1. 숨길 버텍스 식별 (GetBoneWeightForVertex 구현 필요)
-    for (uint32 VertexIndex = 0; VertexIndex < NumVertices; ++VertexIndex)
-    {
-        // GetBoneWeightForVertex 함수는 FSkinWeightVertexBuffer 구조에 맞춰 구현해야 합니다.
-        // 아래는 가상의 함수 호출입니다. 실제 구현은 SkinWeightBuffer->GetWeightForVertex 등을 사용해야 합니다.
-        float Weight = GetBoneWeightForVertex(VertexIndex, TargetBoneIndex, &LODRenderData.RenderSections[LODIndex], &LODRenderData, SkinWeightBuffer);
-
-        if (Weight > Threshold)
-        {
-            VerticesToHideIndices.Add(VertexIndex);
-        }
-    }
+    TArray<FLinearColor> OverrideColors;
+    const int32 NumHiddenVertices = BuildHiddenVertexColors(LODRenderData, InOriginalToCutIndices, OverrideColors);
 
-    // 2. 숨길 버텍스가 있는 경우에만 오버라이드 적용
-    if (VerticesToHideIndices.Num() > 0)
+    // 숨길 버텍스가 있는 경우에만 오버라이드 적용 (절단 본이 여러 개여도 업로드는 한 번)
+    if (NumHiddenVertices > 0)
     {
-        // 3. 버텍스 컬러 오버라이드 배열 준비
-        TArray<FLinearColor> OverrideColors;
-        OverrideColors.SetNum(NumVertices);
-
-        // 기존 컬러 버퍼 확인
-        const FColorVertexBuffer* ExistingColorBuffer = LODRenderData.StaticVertexBuffers.ColorVertexBuffer.IsInitialized() ?
-                                                        &LODRenderData.StaticVertexBuffers.ColorVertexBuffer : nullptr;
-
-        // 배열 초기화 (기존 색상 또는 흰색)
-        for (uint32 i = 0; i < NumVertices; ++i)
-        {
-            if (ExistingColorBuffer && i < ExistingColorBuffer->GetNumVertices())
-            {
-                OverrideColors[i] = ExistingColorBuffer->VertexColor(i).ReinterpretAsLinear();
-            }
-            else
-            {
-                OverrideColors[i] = FLinearColor::White; // 기본값 (Alpha = 1)
-            }
-        }
-
-        // 4. 숨길 버텍스의 알파 값을 0으로 설정
-        for (int32 HideIndex : VerticesToHideIndices)
-        {
-            if (OverrideColors.IsValidIndex(HideIndex))
-            {
-                OverrideColors[HideIndex].A = 0.0f; // 알파를 0으로 만들어 숨김
-            }
-        }
-
-        // 5. 컴포넌트에 오버라이드 적용
         SourceSkeletalMeshComp->SetVertexColorOverride_LinearColor(LODIndex, OverrideColors);
-         UE_LOG(LogTemp, Log, TEXT("Applied vertex color override to hide %d vertices for bone '%s' on LOD %d."), VerticesToHideIndices.Num(), *TargetBoneName.ToString(), LODIndex);
+         UE_LOG(LogAdvancedAction, Log, TEXT("Applied vertex color override to hide %d vertices on LOD %d."), NumHiddenVertices, LODIndex);
         return true;
     }
     else if (bClearOverride)
     {
         // 숨길 버텍스가 없고, 이전 오버라이드를 지우도록 설정된 경우
         SourceSkeletalMeshComp->ClearVertexColorOverride(LODIndex);
-        UE_LOG(LogTemp, Log, TEXT("No vertices to hide for bone '%s' on LOD %d. Cleared override (if any)."), *TargetBoneName.ToString(), LODIndex);
+        UE_LOG(LogAdvancedAction, Log, TEXT("No vertices to hide on LOD %d. Cleared override (if any)."), LODIndex);
         return true; // 작업은 성공적으로 완료됨 (숨길 것이 없었음)
     }
 
     return true; // 숨길 것이 없었음
 }
 
-bool USkelToProcMeshComponent::BuildSkinningDataForProceduralMesh(
-    const USkeletalMeshComponent* SkelComp,
-    int32 LODIndex,
-    const TArray<FVector>& InProcMeshVertices, // 이 버텍스들은 로컬 바인드 포즈 위치
-    const TMap<uint32, uint32>& InOriginalToProcVertexMap, // Key: OriginalSkelVIdx, Value: ProcMeshVIdx (InProcMeshVertices 배열의 인덱스)
-    TArray<FProceduralVertexSkinningData>& OutSkinningData)
+int32 USkelToProcMeshComponent::BuildHiddenVertexColors(const FSkeletalMeshLODRenderData& LODRenderData, TConstArrayView<uint8> InOriginalToCutIndices, TArray<FLinearColor>& OutOverrideColors)
 {
-    if (!SkelComp || !SkelComp->GetSkeletalMeshAsset()) return false;
+    OutOverrideColors.Reset();
+    const uint32 NumVertices = LODRenderData.GetNumVertices();
 
-    FSkeletalMeshRenderData* RenderData = SkelComp->GetSkeletalMeshAsset()->GetResourceForRendering();
-    if (!RenderData || !RenderData->LODRenderData.IsValidIndex(LODIndex)) return false;
-
-    const FSkeletalMeshLODRenderData& LODRenderData = RenderData->LODRenderData[LODIndex];
-    const FSkinWeightVertexBuffer* SkinWeightBuffer = LODRenderData.GetSkinWeightVertexBuffer();
-
-    if (!SkinWeightBuffer || SkinWeightBuffer->GetNumVertices() == 0)
+    // 1. 숨길 버텍스 식별: 추출 단계에서 채운 원본 -> 절단 테이블에서 어느 절단에든 배정된 버텍스
+    int32 NumHiddenVertices = 0;
+    const uint32 NumMappedVertices = FMath::Min<uint32>(NumVertices, InOriginalToCutIndices.Num());
+    for (uint32 i = 0; i < NumMappedVertices; ++i)
     {
-        UE_LOG(LogTemp, Error, TEXT("BuildSkinningDataForProceduralMesh: SkinWeightVertexBuffer is invalid or empty for LOD %d."), LODIndex);
-        return false;
+        NumHiddenVertices += InOriginalToCutIndices[i] != NoCutIndex ? 1 : 0;
+    }
+    if (NumHiddenVertices == 0)
+    {
+        return 0;
     }
 
-    OutSkinningData.Empty(InProcMeshVertices.Num());
-    OutSkinningData.SetNum(InProcMeshVertices.Num()); // 프로시저럴 메시 버텍스 수만큼 초기화
+    // 2. 버텍스 컬러 오버라이드 배열 준비
+    OutOverrideColors.SetNumUninitialized(NumVertices);
 
-    // InOriginalToProcVertexMap은 (Original Skel VIdx -> Proc VIdx) 이므로, 역방향 맵이 필요하거나 순회 방식 변경 필요.
-    // 또는, ProcMesh 버텍스를 순회하면서 Original Skel VIdx를 찾아야 함.
+    // 기존 컬러 버퍼 확인
+    const FColorVertexBuffer* ExistingColorBuffer = LODRenderData.StaticVertexBuffers.ColorVertexBuffer.IsInitialized() ?
+                                                    &LODRenderData.StaticVertexBuffers.ColorVertexBuffer : nullptr;
 
-    // 현재 InOriginalToProcVertexMap (Key: OriginalSkelVertexIdx, Value: ProcMeshVertexIdx)를 사용한다고 가정.
-    // 이 맵은 모든 '필터링된' 원본 버텍스에 대한 정보만 담고 있음.
-    // OutSkinningData는 ProcMesh 버텍스 순서대로 채워져야 함.
-    // 따라서 ProcMesh 버텍스를 0부터 N-1까지 순회하면서, 각 ProcMesh 버텍스에 해당하는 OriginalSkelVertexIdx를 찾아야 함.
+    // 배열 초기화 (기존 색상 또는 흰색), 숨길 버텍스의 알파 값은 0으로 설정
+    for (uint32 i = 0; i < NumVertices; ++i)
+    {
+        if (ExistingColorBuffer && i < ExistingColorBuffer->GetNumVertices())
+        {
+            OutOverrideColors[i] = ExistingColorBuffer->VertexColor(i).ReinterpretAsLinear();
+        }
+        else
+        {
+            OutOverrideColors[i] = FLinearColor::White; // 기본값 (Alpha = 1)
+        }
 
-    // InOriginalToProcVertexMap의 Value를 기준으로 OriginalSkelVertexIdx를 찾는 것은 비효율적.
-    // ProcMesh 버텍스 배열(InProcMeshVertices)을 만들 때, 각 ProcMesh 버텍스가 어떤 OriginalSkelVertexIdx에서 왔는지
-    // 별도의 배열(ProcToOriginalVertexMap[ProcVIdx] = OriginalSkelVIdx)로 저장하는 것이 더 효율적.
-    // 현재 OriginalToMainProcVertexMap (멤버변수)이 (OriginalSkelVIdx -> MainProcVIdx)로 채워짐.
+        if (i < NumMappedVertices && InOriginalToCutIndices[i] != NoCutIndex)
+        {
+            OutOverrideColors[i].A = 0.0f; // 알파를 0으로 만들어 숨김
+        }
+    }
+    return NumHiddenVertices;
+}
 
-    for (auto const& Pair : OriginalToMainProcVertexMap) // OriginalToMainProcVertexMap은 (Original Idx -> Proc Idx)
+void USkelToProcMeshComponent::UpdateProceduralMeshesSkinning()
+{
+    switch (SkinningMode)
     {
-        uint32 OriginalSkelVertexIdx = Pair.Key;
-        uint32 ProcMeshVertexIdx = Pair.Value; // 이 인덱스가 OutSkinningData 배열의 인덱스가 됨
+    case ESkelToProcSkinningMode::Async:
+        // 결과 회수와 업로드는 SkinningCompletionTick(Post-Update-Work)에서 처리
+        CompleteAsyncSkinning();
+        if (PrepareSkinningJobs())
+        {
+            KickAsyncSkinning();
+        }
+        break;
 
-        if (OutSkinningData.IsValidIndex(ProcMeshVertexIdx))
+    case ESkelToProcSkinningMode::AsyncOneFrameLatency:
+        // 이전 프레임 결과를 회수한 뒤 곧바로 다음 스키닝을 시작하고, 워커가 도는 동안 이전 결과를 업로드
+        CompleteAsyncSkinning();
+        if (PrepareSkinningJobs())
         {
-            OutSkinningData[ProcMeshVertexIdx].LocalBindPosePosition = InProcMeshVertices[ProcMeshVertexIdx]; // 이미 로컬 위치로 제공됨
-            if (!GetSkinWeightsForOriginalVertex(SkelComp, OriginalSkelVertexIdx, LODRenderData, SkinWeightBuffer, OutSkinningData[ProcMeshVertexIdx]))
-            {
-                UE_LOG(LogTemp, Warning, TEXT("BuildSkinningData: Failed to get skin weights for OriginalSkelVertexIdx %u (ProcMeshVertexIdx %u)"), OriginalSkelVertexIdx, ProcMeshVertexIdx);
-                // 스키닝 정보가 없는 버텍스는 어떻게 처리할지? (예: 루트 본에 고정, 스키닝 안함 등)
-                // 여기서는 일단 LocalBindPosePosition만 설정된 상태로 둠.
-            }
+            KickAsyncSkinning();
         }
-        else
+        UploadPresentedSkinning();
+        break;
+
+    case ESkelToProcSkinningMode::Synchronous:
+    default:
+        // 모드가 런타임에 바뀐 경우를 위해 남은 비동기 작업을 먼저 정리
+        CompleteAsyncSkinning();
+        if (PrepareSkinningJobs())
         {
-            UE_LOG(LogTemp, Error, TEXT("BuildSkinningData: ProcMeshVertexIdx %u from map is out of bounds for OutSkinningData (Size: %d)"), ProcMeshVertexIdx, OutSkinningData.Num());
+            // 버텍스 커널: 모든 조각의 버텍스를 청크로 나눠 워커 스레드에서 스키닝하고 여기서 조인
+            ProcMeshSkinning::SkinJobsParallel(ActiveSkinningJobs);
+            PresentSkinningJobs();
+            UploadPresentedSkinning();
         }
+        break;
     }
+}
 
-    return true;
+bool USkelToProcMeshComponent::PrepareSkinningJobs()
+{
+    // 팔레트는 워커가 읽는 중일 수 있으므로 이전 태스크가 끝난 뒤에만 갱신
+    check(PendingSkinningTask.IsCompleted());
+
+    USkeletalMeshComponent* SkelComp = GetOwnerSkeletalMeshComponent();
+    if (!SkelComp || !SkelComp->GetSkeletalMeshAsset() || RefBoneInverseBindMatrices.Num() == 0)
+    {
+        //UE_LOG(LogAdvancedAction, Verbose, TEXT("UpdateProceduralMeshesSkinning: Prerequisites not met (SkelComp, Asset, or InvBindMatrices)."));
+        return false;
+    }
+
+    // 현재 본 트랜스폼 (컴포넌트 공간)
+    const TArray<FTransform>& CurrentBoneTransforms = SkelComp->GetComponentSpaceTransforms();
+    if (CurrentBoneTransforms.Num() == 0)
+    {
+        //UE_LOG(LogAdvancedAction, Verbose, TEXT("UpdateProceduralMeshesSkinning: CurrentBoneTransforms is empty."));
+        return false;
+    }
+
+    // 스키닝 대상 조각 수집 및 팔레트 단계 (게임 스레드, 조각이 참조하는 본마다 한 번씩)
+    SCOPE_CYCLE_COUNTER(STAT_ProcMeshSkinning_Palette);
+    TRACE_CPUPROFILER_EVENT_SCOPE(USkelToProcMeshComponent::PrepareSkinningJobs);
+
+    int32 NumSkinnedVertices = 0;
+    ActiveSkinningJobs.Reset();
+    for (FSkelToProcMeshPiece& Piece : Pieces)
+    {
+        FProcMeshSkinningJob& Job = Piece.SkinningJob;
+        Job.Buffer = nullptr;
+        if (!Piece.ProcMesh || Piece.ProcMesh->GetNumSections() == 0 || Piece.SkinningData.IsEmpty()) continue;
+
+        Job.Buffer = &Piece.SkinningData;
+        Piece.SkinningData.BuildSkinningPalette(RefBoneInverseBindMatrices, CurrentBoneTransforms, Job.Palette);
+        ActiveSkinningJobs.Add(&Job);
+        NumSkinnedVertices += Piece.SkinningData.Num();
+    }
+
+    INC_DWORD_STAT_BY(STAT_ProcMeshSkinning_SkinnedVertices, NumSkinnedVertices);
+    CSV_CUSTOM_STAT(AdvancedAction, SkinnedVertices, NumSkinnedVertices, ECsvCustomStatOp::Accumulate);
+    return ActiveSkinningJobs.Num() > 0;
 }
 
-bool USkelToProcMeshComponent::GetSkinWeightsForOriginalVertex(
-    const USkeletalMeshComponent* SkelComp,
-    uint32 OriginalSkelVertexIndex,
-    const FSkeletalMeshLODRenderData& LODRenderData,
-    const FSkinWeightVertexBuffer* SkinWeightBuffer,
-    FProceduralVertexSkinningData& OutVertexSkinningData) // BoneMapIndices와 BoneWeights를 채움
+void USkelToProcMeshComponent::KickAsyncSkinning()
 {
-    if (!SkinWeightBuffer || OriginalSkelVertexIndex >= SkinWeightBuffer->GetNumVertices()) return false;
+    // 태스크는 잡과 스키닝 버퍼만 읽고 쓰며, 컴포넌트가 파괴되거나 버퍼가 다시 빌드되기 전에는 항상 대기함
+    PendingSkinningTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [this]()
+    {
+        ProcMeshSkinning::SkinJobsParallel(ActiveSkinningJobs);
+    });
+}
 
-    const int32 MaxInfluences = SkinWeightBuffer->GetMaxBoneInfluences();
-    const FReferenceSkeleton& RefSkeleton = SkelComp->GetSkeletalMeshAsset()->GetRefSkeleton();
+void USkelToProcMeshComponent::CompleteAsyncSkinning()
+{
+    if (!PendingSkinningTask.IsValid())
+    {
+        return;
+    }
 
-    OutVertexSkinningData.BoneMapIndices.Empty(MaxInfluences);
-    OutVertexSkinningData.BoneWeights.Empty(MaxInfluences);
+    PendingSkinningTask.Wait();
+    PendingSkinningTask = UE::Tasks::FTask();
+    PresentSkinningJobs();
+}
 
-    float TotalWeight = 0.f;
+void USkelToProcMeshComponent::PresentSkinningJobs()
+{
+    const bool bKeepPrevious = bInterpolateThrottledSkinning && !bResetSkinningHistory;
+    for (FProcMeshSkinningJob* Job : ActiveSkinningJobs)
+    {
+        Job->Present(bKeepPrevious);
+    }
+    bResetSkinningHistory = false;
+}
 
-    for (int32 InfluenceIdx = 0; InfluenceIdx < MaxInfluences; ++InfluenceIdx)
+ESkelToProcSkinningThrottle USkelToProcMeshComponent::EvaluateSkinningThrottle()
+{
+    if (!bThrottleSkinning || !CVarSkinningThrottle.GetValueOnGameThread())
     {
-        uint16 RawWeight = SkinWeightBuffer->GetBoneWeight(OriginalSkelVertexIndex, InfluenceIdx);
-        if (RawWeight > 0) // 가중치가 0인 본은 무시
-        {
-            // SkinWeightBuffer.GetBoneIndex()는 LODRenderData.ActiveBoneIndices 배열에 대한 인덱스를 반환.
-            FBoneIndexType LODActiveBoneIndex = SkinWeightBuffer->GetBoneIndex(OriginalSkelVertexIndex, InfluenceIdx);
+        SkinningInterval = 1;
+        SkinningFrameCounter = 0;
+        bSkinningFrozenAtRest = false;
+        return ESkelToProcSkinningThrottle::Skin;
+    }
 
-            if (LODRenderData.ActiveBoneIndices.IsValidIndex(LODActiveBoneIndex))
-            {
-                // ActiveBoneIndices 배열의 값은 실제 RefSkeleton에 대한 본 인덱스.
-                FBoneIndexType SkeletonBoneIndex = LODRenderData.ActiveBoneIndices[LODActiveBoneIndex];
-                
-                OutVertexSkinningData.BoneMapIndices.Add(SkeletonBoneIndex);
-                float NormalizedWeight = static_cast<float>(RawWeight) / 255.0f; // GetMaxBoneWeight()는 보통 255.0f
-                OutVertexSkinningData.BoneWeights.Add(NormalizedWeight);
-                TotalWeight += NormalizedWeight;
-            }
-            else
-            {
-                UE_LOG(LogTemp, Warning, TEXT("GetSkinWeightsForOriginalVertex: Invalid LODActiveBoneIndex %d from SkinWeightBuffer for OriginalSkelVertexIndex %u"), LODActiveBoneIndex, OriginalSkelVertexIndex);
-            }
-        }
+    USkeletalMeshComponent* SkelComp = GetOwnerSkeletalMeshComponent();
+    if (!SkelComp)
+    {
+        return ESkelToProcSkinningThrottle::Skip;
     }
-    
-    // 가중치 합계가 1에 가깝도록 정규화 (선택 사항, 보통 이미 정규화되어 있음)
-    if (TotalWeight > KINDA_SMALL_NUMBER && FMath::Abs(TotalWeight - 1.0f) > KINDA_SMALL_NUMBER)
+
+    // 1. 정지: 래그돌 바디가 모두 잠들었으면 마지막 포즈로 한 번(보간 없이) 스키닝한 뒤 멈춤
+    if (bFreezeSkinningAtRest && SkelComp->IsSimulatingPhysics() && !SkelComp->IsAnyRigidBodyAwake())
     {
-        //UE_LOG(LogTemp, Verbose, TEXT("Normalizing weights for vertex %u. Original total: %f"), OriginalSkelVertexIndex, TotalWeight);
-        for (int i = 0; i < OutVertexSkinningData.BoneWeights.Num(); ++i)
+        if (bSkinningFrozenAtRest)
         {
-            OutVertexSkinningData.BoneWeights[i] /= TotalWeight;
+            return ESkelToProcSkinningThrottle::Skip;
         }
+        bSkinningFrozenAtRest = true;
+        FrozenAtRestTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0;
+        SkinningInterval = 1;
+        SkinningFrameCounter = 0;
+        return ESkelToProcSkinningThrottle::Skin;
+    }
+    if (bSkinningFrozenAtRest)
+    {
+        bSkinningFrozenAtRest = false;
+        bResetSkinningHistory = true;
     }
 
-    return OutVertexSkinningData.BoneMapIndices.Num() > 0;
-}
+    // 2. 가시성: 원본 메시(숨긴 버텍스 외 부분)나 조각 중 하나라도 최근에 그려졌는지
+    bool bRecentlyRendered = SkelComp->WasRecentlyRendered(NotRenderedSkinningTimeout);
+    for (int32 PieceIdx = 0; PieceIdx < Pieces.Num() && !bRecentlyRendered; ++PieceIdx)
+    {
+        const UMeshComponent* ProcMesh = Pieces[PieceIdx].ProcMesh;
+        bRecentlyRendered = ProcMesh && ProcMesh->WasRecentlyRendered(NotRenderedSkinningTimeout);
+    }
+    if (!bRecentlyRendered)
+    {
+        // 다시 보이는 첫 프레임에 바로 스키닝하고, 오래된 결과에서 보간하지 않음
+        SkinningFrameCounter = FMath::Max(MaxSkinningInterval, 1);
+        bResetSkinningHistory = true;
+        return ESkelToProcSkinningThrottle::Skip;
+    }
 
+    // 3. 거리: 간격마다 한 번 스키닝하고, 그 사이 프레임은 보간하거나 건너뜀
+    const int32 Interval = ComputeSkinningInterval(*SkelComp);
+    if (++SkinningFrameCounter >= Interval)
+    {
+        SkinningInterval = Interval;
+        SkinningFrameCounter = 0;
+        return ESkelToProcSkinningThrottle::Skin;
+    }
+    return bInterpolateThrottledSkinning ? ESkelToProcSkinningThrottle::Interpolate : ESkelToProcSkinningThrottle::Skip;
+}
 
-void USkelToProcMeshComponent::UpdateProceduralMeshesSkinning()
+int32 USkelToProcMeshComponent::ComputeSkinningInterval(const USkeletalMeshComponent& SkelComp) const
 {
-    USkeletalMeshComponent* SkelComp = GetOwnerSkeletalMeshComponent();
-    if (!SkelComp || !SkelComp->GetSkeletalMeshAsset() || RefBoneInverseBindMatrices.Num() == 0)
+    // 렌더러가 지난 프레임에 쓴 시점들 (분할 화면, 씬 캡처 포함). 전용 서버 등 시점이 없으면 매 프레임
+    const UWorld* World = GetWorld();
+    if (!World || World->ViewLocationsRenderedLastFrame.Num() == 0 || SkinningIntervalDistanceStep <= 0.f)
     {
-        //UE_LOG(LogTemp, Verbose, TEXT("UpdateProceduralMeshesSkinning: Prerequisites not met (SkelComp, Asset, or InvBindMatrices)."));
-        return;
+        return 1;
     }
 
-    // 현재 본 트랜스폼 (컴포넌트 공간)
-    const TArray<FTransform>& CurrentBoneTransforms = SkelComp->GetBoneSpaceTransforms();
-    if (CurrentBoneTransforms.Num() == 0)
+    double MinDistSquared = UE_BIG_NUMBER;
+    for (const FVector& ViewLocation : World->ViewLocationsRenderedLastFrame)
     {
-        //UE_LOG(LogTemp, Verbose, TEXT("UpdateProceduralMeshesSkinning: CurrentBoneTransforms is empty."));
-        return;
+        MinDistSquared = FMath::Min(MinDistSquared, FVector::DistSquared(ViewLocation, SkelComp.Bounds.Origin));
     }
 
-    auto PerformSkinning = [&](UProceduralMeshComponent* ProcMesh, const TArray<FProceduralVertexSkinningData>& SkinningData)
+    const double ExcessDistance = FMath::Sqrt(MinDistSquared) - FullRateSkinningDistance;
+    if (ExcessDistance <= 0.0)
     {
-        if (!ProcMesh || ProcMesh->GetNumSections() == 0 || SkinningData.Num() == 0) return;
+        return 1;
+    }
+    return FMath::Clamp(1 + FMath::CeilToInt(ExcessDistance / SkinningIntervalDistanceStep), 1, FMath::Max(MaxSkinningInterval, 1));
+}
 
-        // 첫 번째 섹션의 버텍스 수와 스키닝 데이터 수가 일치하는지 확인 (간단한 경우)
-        // 실제로는 모든 섹션의 버텍스를 합한 수와 일치해야 하거나, 섹션별로 스키닝 데이터를 가져야 함.
-        // 현재 스키닝 데이터는 전체 프로시저럴 메시에 대해 하나의 배열로 관리.
-        // CreateMeshSection_LinearColor에서 버텍스 배열을 전체로 넘겼다면 이 방식이 맞음.
-        
-        FProcMeshSection* Section = ProcMesh->GetProcMeshSection(0); // 첫번째 섹션으로 가정
-        if (!Section || Section->ProcVertexBuffer.Num() != SkinningData.Num())
-        {
-            //UE_LOG(LogTemp, Warning, TEXT("UpdateProceduralMeshesSkinning: Vertex count mismatch for ProcMesh %s. Section0 Verts: %d, SkinData Verts: %d"),*ProcMesh->GetName(), Section ? Section->ProcVertexBuffer.Num() : -1, SkinningData.Num());
-            // return; // 수가 다르면 일단 스키닝 중단 또는 다른 섹션도 확인
-        }
+void USkelToProcMeshComponent::UploadPresentedSkinning(bool bMustPresent)
+{
+    SCOPE_CYCLE_COUNTER(STAT_ProcMeshSkinning_Upload);
+    TRACE_CPUPROFILER_EVENT_SCOPE(USkelToProcMeshComponent::UploadPresentedSkinning);
 
+    // 스로틀링된 간격 안에서의 보간 비율. 스키닝한 프레임은 1/간격, 다음 스키닝 직전 프레임은 1
+    const float InterpolationAlpha = bInterpolateThrottledSkinning && SkinningInterval > 1
+        ? FMath::Min(static_cast<float>(SkinningFrameCounter + 1) / SkinningInterval, 1.0f)
+        : 1.0f;
 
-        TArray<FVector> NewSkinnedVertexPositions;
-        NewSkinnedVertexPositions.SetNumUninitialized(SkinningData.Num());
+    // 멈춘 뒤와 굳힐 때는 이 결과가 마지막이므로 버리면 이전 포즈가 남거나 구워짐
+    const bool bWaitForFreeSlot = bMustPresent || bSkinningFrozenAtRest;
 
-        // 노멀과 탄젠트도 스키닝하려면 추가 배열 필요
-        TArray<FVector> NewSkinnedNormals;
-        TArray<FProcMeshTangent> NewSkinnedTangents;
-        bool bSkinNormalsAndTangents = true; // 필요에 따라 false로 설정 가능
+    // 업로드 단계: 조인 이후 게임 스레드에서 조각마다 스트림 전체를 링 슬롯 하나에 씀 (프론트 버퍼만 읽으므로 진행 중인 태스크와 겹쳐도 안전)
+    // 렌더 스레드가 영구 정점 버퍼에 섹션 구간별로 복사하므로 섹션 재생성 없음
+    auto UploadSkinnedVertices = [InterpolationAlpha, bWaitForFreeSlot](const FSkelToProcMeshPiece& Piece)
+    {
+        UProcMeshPieceComponent* PieceMesh = Piece.ProcMesh;
+        const FProcMeshSkinningJob& Job = Piece.SkinningJob;
+        if (!PieceMesh || !Job.HasPresentedResult() || Piece.SectionVertexOffsets.Num() == 0 || Piece.SectionVertexOffsets.Last() != Job.Buffer->Num()) return;
 
-        if (bSkinNormalsAndTangents)
+        const FProcMeshSkinningBuffer& SkinningData = *Job.Buffer;
+        const FVector3f* PreviousPositions = InterpolationAlpha < 1.0f && Job.HasPreviousResult() ? Job.PreviousPositions.GetData() : nullptr;
+
+        const int32 NumVertices = SkinningData.Num();
+        FProcMeshPieceSkinnedFrame* Frame = PieceMesh->BeginSkinnedFrame(NumVertices, bWaitForFreeSlot);
+        if (!Frame)
         {
-            NewSkinnedNormals.SetNumUninitialized(SkinningData.Num());
-            NewSkinnedTangents.SetNumUninitialized(SkinningData.Num());
+            // 렌더 스레드가 밀려 있으면 이번 결과는 버림 (다음 틱에 최신 결과로 갱신)
+            INC_DWORD_STAT(STAT_ProcMeshSkinning_DroppedFrames);
+            return;
         }
 
-
-        for (int32 VertexIdx = 0; VertexIdx < SkinningData.Num(); ++VertexIdx)
+        for (int32 VertexIdx = 0; VertexIdx < NumVertices; ++VertexIdx)
         {
-            const FProceduralVertexSkinningData& VertexSkinData = SkinningData[VertexIdx];
-            FVector SkinnedPosition = FVector::ZeroVector;
-            FVector SkinnedNormal = FVector::ZeroVector;   // (0,0,1) 또는 원본 노멀로 초기화 가능
-            FVector SkinnedTangentX = FVector::ZeroVector; // (1,0,0) 또는 원본 탄젠트로 초기화 가능
-
-            // 원본 버텍스의 노멀/탄젠트 가져오기 (스키닝 데이터에 저장되어 있지 않으므로, ProcMesh에서 읽거나, 바인드 포즈 값을 알아야 함)
-            // 여기서는 간단히 바인드 포즈의 Z축/X축으로 가정하거나, 실제 값을 가져와야 함.
-            // GetFilteredSkeletalMeshDataByBoneName에서 Normals_Main, Tangents_Main을 가져왔으므로,
-            // 이 값들을 FProceduralVertexSkinningData에 추가로 저장해두는 것이 좋음. (LocalBindPoseNormal, LocalBindPoseTangent)
-            // 지금은 LocalBindPosePosition만 있음.
-            // 임시로, 바인드 포즈 노멀/탄젠트는 ProceduralMeshComponent에서 직접 읽어온다고 가정 (최초 생성 시의 값)
-            // 또는, SkinningData 구조체에 바인드 포즈 노멀/탄젠트도 저장해야 함.
+            Frame->Positions[VertexIdx] = PreviousPositions
+                ? FMath::Lerp(PreviousPositions[VertexIdx], Job.PresentedPositions[VertexIdx], InterpolationAlpha)
+                : Job.PresentedPositions[VertexIdx];
+        }
 
-            FVector OriginalNormal = FVector::UpVector; // 임시 기본값
-            FVector OriginalTangentX = FVector::RightVector; // 임시 기본값
+        // 스키닝된 탄젠트 프레임은 렌더 탄젠트 버퍼와 레이아웃이 같으므로 그대로 복사
+        FMemory::Memcpy(Frame->Tangents.GetData(), Job.PresentedTangents.GetData(), NumVertices * 2 * sizeof(FPackedNormal));
+        PieceMesh->SubmitSkinnedFrame(Frame, Piece.SectionVertexOffsets);
+    };
 
-            if (Section && Section->ProcVertexBuffer.IsValidIndex(VertexIdx))
-            {
-                 // ProceduralMeshComponent는 스키닝 전의 바인드포즈 데이터를 가지고 있어야 함.
-                 // 만약 매번 UpdateMeshSection으로 덮어쓰면 이 값은 현재 스키닝된 값이 됨.
-                 // 따라서 LocalBindPosePosition 등을 사용.
-                 // 노멀/탄젠트도 스키닝 데이터에 LocalBindPoseNormal/Tangent 로 저장하는 것이 좋음.
-                 // 현재는 없으므로, 스키닝 정보의 LocalBindPosePosition으로 위치를 가져오고,
-                 // 노멀/탄젠트는 해당 버텍스의 원래 값 (예: ProcMesh->GetProcMeshSection(0)->ProcVertexBuffer[VertexIdx].Normal)을 사용한다고 가정.
-                 // 하지만 이 값은 이전 프레임에 스키닝된 값일 수 있으므로 주의.
-                 // ===> FProceduralVertexSkinningData에 LocalBindPoseNormal, LocalBindPoseTangentX 추가 필요!
-
-                 // 임시: 원본 노멀/탄젠트가 없으므로 스키닝 시 기본값 사용하거나, 위치만 스키닝
-            }
+    // 모든 조각 (스키닝 데이터가 빌드된 조각만 결과가 존재)
+    for (const FSkelToProcMeshPiece& Piece : Pieces)
+    {
+        UploadSkinnedVertices(Piece);
+    }
+}
 
+void USkelToProcMeshComponent::SettlePieces()
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(USkelToProcMeshComponent::SettlePieces);
 
-            for (int32 InfluenceIdx = 0; InfluenceIdx < VertexSkinData.BoneMapIndices.Num(); ++InfluenceIdx)
-            {
-                int32 BoneMapIndex = VertexSkinData.BoneMapIndices[InfluenceIdx];
-                float BoneWeight = VertexSkinData.BoneWeights[InfluenceIdx];
+    if (bSettled || Pieces.Num() == 0)
+    {
+        return;
+    }
 
-                if (CurrentBoneTransforms.IsValidIndex(BoneMapIndex) && RefBoneInverseBindMatrices.IsValidIndex(BoneMapIndex))
-                {
-                    const FMatrix InverseBindMatrix = RefBoneInverseBindMatrices[BoneMapIndex];
-                    const FMatrix CurrentBoneMatrix = CurrentBoneTransforms[BoneMapIndex].ToMatrixWithScale();
-                    
-                    // 최종 스키닝 매트릭스 (로컬 바인드 -> 현재 컴포넌트 공간)
-                    FMatrix FinalSkinMatrix = InverseBindMatrix * CurrentBoneMatrix;
-
-                    SkinnedPosition += FinalSkinMatrix.TransformPosition(VertexSkinData.LocalBindPosePosition) * BoneWeight;
-
-                    if (bSkinNormalsAndTangents)
-                    {
-                        // 노멀과 탄젠트는 방향 벡터이므로 TransformVector 사용 (Non-uniform scale 시 문제 가능성, 정규화 필요)
-                        // FProceduralVertexSkinningData 에 LocalBindPoseNormal, LocalBindPoseTangentX 가 있다고 가정하고 추가해야 함.
-                        // SkinnedNormal += FinalSkinMatrix.TransformVector(VertexSkinData.LocalBindPoseNormal).GetSafeNormal() * BoneWeight;
-                        // SkinnedTangentX += FinalSkinMatrix.TransformVector(VertexSkinData.LocalBindPoseTangentX).GetSafeNormal() * BoneWeight;
-                    }
-                }
-            }
-            NewSkinnedVertexPositions[VertexIdx] = SkinnedPosition;
-            if (bSkinNormalsAndTangents)
-            {
-                // NewSkinnedNormals[VertexIdx] = SkinnedNormal.GetSafeNormal();
-                // NewSkinnedTangents[VertexIdx] = FProcMeshTangent(SkinnedTangentX.GetSafeNormal(), false); // Assume bFlipTangentY is false
-                // 임시: 노멀/탄젠트 스키닝은 FProceduralVertexSkinningData에 원본 값 추가 후 구현
-                 if (Section && Section->ProcVertexBuffer.IsValidIndex(VertexIdx))
-                 {
-                    NewSkinnedNormals[VertexIdx] = Section->ProcVertexBuffer[VertexIdx].Normal; // 임시로 기존 값 유지
-                    NewSkinnedTangents[VertexIdx] = Section->ProcVertexBuffer[VertexIdx].Tangent; // 임시로 기존 값 유지
-                 }
-                 else
-                 {
-                    NewSkinnedNormals[VertexIdx] = FVector::UpVector;
-                    NewSkinnedTangents[VertexIdx] = FProcMeshTangent(FVector::RightVector, false);
-                 }
+    // 대기/진행 중인 절단이 있으면 굳히지 않음. 워커가 CutRequest를 쓰는 중일 수 있고, 끝나면 조각이 새로 만들어짐
+    if (IsCutInProgress())
+    {
+        return;
+    }
 
-            }
-        }
+    // 돌고 있는 스키닝이 있으면 결과를 받아, 보간 없이 마지막 포즈를 모든 섹션에 한 번 더 올림
+    CompleteAsyncSkinning();
+    SkinningInterval = 1;
+    UploadPresentedSkinning(true);
+    USkeletalMeshComponent* SkelComp = GetOwnerSkeletalMeshComponent();
 
-        // 프로시저럴 메시 섹션 업데이트 (현재는 첫 번째 섹션만)
-        // UV, VertexColor 등은 업데이트하지 않으므로 빈 배열 전달
-        if (bSkinNormalsAndTangents)
+    for (FSkelToProcMeshPiece& Piece : Pieces)
+    {
+        UProcMeshPieceComponent* ProcMesh = Piece.ProcMesh;
+        if (!ProcMesh)
         {
-            ProcMesh->UpdateMeshSection_LinearColor(0, NewSkinnedVertexPositions, NewSkinnedNormals,
-                                                TArray<FVector2D>(), TArray<FLinearColor>(), NewSkinnedTangents);
+            continue;
         }
-        else
+
+        // 마지막 프레임은 프록시에만 있으므로 섹션 데이터에 구워 둠 (프록시가 다시 만들어져도 유지)
+        ProcMesh->BakeSkinnedFrame();
+
+        // 컴포넌트 공간에 스냅되어 있던 조각을 절단 본에 고정해, 나중에 시신이 밀려도 조각이 강체로 따라가게 함
+        if (SkelComp && bEnableRuntimeSkinning)
         {
-            // 위치만 업데이트
-            TArray<FVector> EmptyNormals;
-            TArray<FProcMeshTangent> EmptyTangents;
-             ProcMesh->UpdateMeshSection_LinearColor(0, NewSkinnedVertexPositions, EmptyNormals,
-                                                 TArray<FVector2D>(), TArray<FLinearColor>(), EmptyTangents);
+            ProcMesh->AttachToComponent(SkelComp, FAttachmentTransformRules::KeepWorldTransform, Piece.SourceBoneName);
         }
-    };
 
-    // 메인 프로시저럴 메시 스키닝
-    PerformSkinning(ProceduralMeshComponent, MainProcMeshSkinningData);
+        Piece.SkinningData = FProcMeshSkinningBuffer();
+        Piece.SkinningJob = FProcMeshSkinningJob();
+        Piece.SectionVertexOffsets.Empty();
+    }
+
+    // 스키닝/절단에만 쓰던 상태 해제
+    ActiveSkinningJobs.Empty();
+    RefBoneInverseBindMatrices.Empty();
+    CutRequest.Reset();
 
-    // 다른 쪽 프로시저럴 메시 스키닝
-    if (OtherHalfProceduralMeshComponent) // OtherHalfProcMeshSkinningData가 빌드되었다면
+    bSettled = true;
+    UpdatePieceStats(false);
+    if (UProcMeshCutBudgetSubsystem* Budget = GetWorld() ? GetWorld()->GetSubsystem<UProcMeshCutBudgetSubsystem>() : nullptr)
     {
-        // PerformSkinning(OtherHalfProceduralMeshComponent, OtherHalfProcMeshSkinningData);
-        // 현재 OtherHalfProcMeshSkinningData는 빌드 로직이 없으므로 호출하지 않음.
+        Budget->UnregisterComponent(this);
     }
+
+    PrimaryComponentTick.SetTickFunctionEnable(false);
+    SkinningCompletionTick.SetTickFunctionEnable(false);
+    UE_LOG(LogAdvancedAction, Verbose, TEXT("SkelToProcMeshComponent: '%s' 조각 %d개를 정적 지오메트리로 굳혔습니다."), *GetNameSafe(GetOwner()), Pieces.Num());
+}
+
+int32 USkelToProcMeshComponent::GetNumSkinningVertices() const
+{
+    int32 NumVertices = 0;
+    for (const FSkelToProcMeshPiece& Piece : Pieces)
+    {
+        NumVertices += Piece.SkinningData.Num();
+    }
+    return NumVertices;
+}
+
+void USkelToProcMeshComponent::UpdatePieceStats(bool bRelease)
+{
+    int32 NumPieces = 0;
+    SIZE_T SkinningDataBytes = 0;
+    if (!bRelease)
+    {
+        NumPieces = Pieces.Num();
+        for (const FSkelToProcMeshPiece& Piece : Pieces)
+        {
+            SkinningDataBytes += Piece.SkinningData.GetAllocatedSize();
+        }
+    }
+
+    // 전역 카운터에는 이 컴포넌트의 이전 값과의 차이만 반영
+    DEC_DWORD_STAT_BY(STAT_ProcMeshCut_PiecesAlive, TrackedNumPieces);
+    INC_DWORD_STAT_BY(STAT_ProcMeshCut_PiecesAlive, NumPieces);
+    DEC_MEMORY_STAT_BY(STAT_ProcMeshSkinning_DataMemory, TrackedSkinningDataBytes);
+    INC_MEMORY_STAT_BY(STAT_ProcMeshSkinning_DataMemory, SkinningDataBytes);
+
+    TrackedNumPieces = NumPieces;
+    TrackedSkinningDataBytes = SkinningDataBytes;
 }
 
 
@@ -797,47 +1087,69 @@ bool USkelToProcMeshComponent::SetupProceduralMeshComponent(bool bForceNew)
     AActor* Owner = GetOwner();
     if (!Owner) return false;
 
-    if (bForceNew && ProceduralMeshComponent)
+    if (bForceNew && FirstPieceMesh)
     {
-        // 강제로 새로 생성하는 경우 기존 PMC 파괴
-        ProceduralMeshComponent->DestroyComponent();
-        ProceduralMeshComponent = nullptr;
+        // 강제로 새로 생성하는 경우 기존 첫 조각 컴포넌트는 풀로 돌려주거나 파괴 (이전 조각 목록에서 재사용 후보가 되지 않도록 제외)
+        for (FSkelToProcMeshPiece& Piece : Pieces)
+        {
+            if (Piece.ProcMesh == FirstPieceMesh)
+            {
+                Piece.ProcMesh = nullptr;
+            }
+        }
+        ReleasePieceProceduralMesh(FirstPieceMesh);
+        FirstPieceMesh = nullptr;
+
+        // 풀이 있으면 새 컴포넌트도 풀에서 빌림
+        if (UProcMeshComponentPoolSubsystem* Pool = UProcMeshComponentPoolSubsystem::GetActive(GetWorld()))
+        {
+            FirstPieceMesh = Pool->Acquire();
+        }
     }
 
+    // 할당되지 않은 경우 기존 컴포넌트를 먼저 찾아봅니다.
     if (!ProceduralMeshComponent)
     {
-        // 할당되지 않은 경우 기존 컴포넌트를 먼저 찾아봅니다.
         ProceduralMeshComponent = Owner->FindComponentByClass<UProceduralMeshComponent>();
+    }
 
-        if(!ProceduralMeshComponent)
+    const bool bCreated = !FirstPieceMesh;
+    if (bCreated)
+    {
+        // 새 조각 컴포넌트 생성
+        FirstPieceMesh = NewObject<UProcMeshPieceComponent>(Owner, MakeUniqueObjectName(Owner, UProcMeshPieceComponent::StaticClass(), TEXT("GeneratedProceduralMesh")));
+        if (!FirstPieceMesh)
         {
-             // 새 PMC 생성
-            ProceduralMeshComponent = NewObject<UProceduralMeshComponent>(Owner, TEXT("GeneratedProceduralMesh"));
-            if (ProceduralMeshComponent)
-            {
-                ProceduralMeshComponent->RegisterComponent();
-                // 원하는 경우 씬 루트나 다른 컴포넌트에 어태치합니다.
-                USceneComponent* OwnerRoot = Owner->GetRootComponent();
-                if(OwnerRoot)
-                {
-                    ProceduralMeshComponent->AttachToComponent(OwnerRoot, FAttachmentTransformRules::KeepRelativeTransform);
-                }
-                UE_LOG(LogTemp, Log, TEXT("SkelToProcMeshComponent: 새 ProceduralMeshComponent를 생성했습니다."));
-            }
-            else
-            {
-                 UE_LOG(LogTemp, Error, TEXT("SkelToProcMeshComponent: ProceduralMeshComponent 생성에 실패했습니다."));
-                 return false;
-            }
+            UE_LOG(LogAdvancedAction, Error, TEXT("SkelToProcMeshComponent: 조각 메시 컴포넌트 생성에 실패했습니다."));
+            return false;
+        }
+        FirstPieceMesh->RegisterComponent();
+        UE_LOG(LogAdvancedAction, Verbose, TEXT("SkelToProcMeshComponent: 새 조각 메시 컴포넌트를 생성했습니다."));
+    }
+
+    // 일반 프로시저럴 메시는 스키닝 결과를 섹션마다 다시 올려야 하므로 조각을 그리지 않고 배치 기준으로만 씀.
+    // 첫 조각 컴포넌트를 그 위치에 겹쳐 붙이고, 남아 있는 지오메트리는 비움
+    if (bCreated || bForceNew)
+    {
+        if (ProceduralMeshComponent)
+        {
+            FirstPieceMesh->AttachToComponent(ProceduralMeshComponent, FAttachmentTransformRules::SnapToTargetIncludingScale);
+            UE_LOG(LogAdvancedAction, Log, TEXT("SkelToProcMeshComponent: %s는 배치 기준으로만 쓰고, 조각은 %s가 그립니다."),
+                *ProceduralMeshComponent->GetName(), *FirstPieceMesh->GetName());
         }
-         else
+        else if (USceneComponent* OwnerRoot = Owner->GetRootComponent())
         {
-             UE_LOG(LogTemp, Log, TEXT("SkelToProcMeshComponent: 기존 ProceduralMeshComponent를 찾았습니다."));
+            // 원하는 경우 씬 루트나 다른 컴포넌트에 어태치합니다.
+            FirstPieceMesh->AttachToComponent(OwnerRoot, FAttachmentTransformRules::KeepRelativeTransform);
         }
     }
+    if (ProceduralMeshComponent)
+    {
+        ProceduralMeshComponent->ClearAllMeshSections();
+    }
 
     // 이전 지오메트리 제거
-    ProceduralMeshComponent->ClearAllMeshSections();
-    
-    return (ProceduralMeshComponent != nullptr);
+    FirstPieceMesh->ClearAllMeshSections();
+
+    return (FirstPieceMesh != nullptr);
 }
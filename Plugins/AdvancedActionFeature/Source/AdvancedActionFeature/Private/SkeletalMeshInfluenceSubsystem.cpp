@@ -0,0 +1,331 @@
+#include "SkeletalMeshInfluenceSubsystem.h"
+
+#include "AdvancedActionFeature.h"
+#include "Engine/Engine.h"
+#include "Engine/SkeletalMesh.h"
+#include "GPUSkinPublicDefs.h"
+#include "Misc/ScopeLock.h"
+#include "Rendering/SkeletalMeshLODRenderData.h"
+#include "Rendering/SkeletalMeshRenderData.h"
+
+void FSkeletalMeshBoneInfluenceIndex::Build(const FSkeletalMeshLODRenderData& LODRenderData, int32 NumBones)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(FSkeletalMeshBoneInfluenceIndex::Build);
+
+    NumVertices = 0;
+    BoneOffsets.Reset();
+    VertexIndices.Reset();
+    VertexWeights.Reset();
+
+    const FSkinWeightVertexBuffer* SkinWeightBuffer = LODRenderData.GetSkinWeightVertexBuffer();
+    if (!SkinWeightBuffer || SkinWeightBuffer->GetNumVertices() == 0 || NumBones <= 0)
+    {
+        return;
+    }
+
+    NumVertices = LODRenderData.GetNumVertices();
+    const int32 MaxInfluences = FMath::Min<int32>(SkinWeightBuffer->GetMaxBoneInfluences(), MAX_TOTAL_INFLUENCES);
+
+    // 버텍스 하나의 인플루언스를 스켈레톤 본 기준으로 모음. 같은 본이 여러 슬롯에 있으면 가중치를 합산
+    // (스킨 웨이트 버퍼의 본 인덱스는 렌더 섹션 BoneMap에 대한 로컬 인덱스)
+    auto ForEachVertexInfluence = [&](auto&& Visit)
+    {
+        for (const FSkelMeshRenderSection& Section : LODRenderData.RenderSections)
+        {
+            const TArray<FBoneIndexType>& BoneMap = Section.BoneMap;
+            for (uint32 VertexInSection = 0; VertexInSection < Section.NumVertices; ++VertexInSection)
+            {
+                const uint32 VertexIndex = Section.BaseVertexIndex + VertexInSection;
+
+                int32 Bones[MAX_TOTAL_INFLUENCES];
+                uint32 RawWeights[MAX_TOTAL_INFLUENCES];
+                int32 NumInfluences = 0;
+                for (int32 InfluenceIdx = 0; InfluenceIdx < MaxInfluences; ++InfluenceIdx)
+                {
+                    const uint16 RawWeight = SkinWeightBuffer->GetBoneWeight(VertexIndex, InfluenceIdx);
+                    const uint32 LocalBoneIndex = SkinWeightBuffer->GetBoneIndex(VertexIndex, InfluenceIdx);
+                    if (RawWeight == 0 || !BoneMap.IsValidIndex(LocalBoneIndex)) continue;
+
+                    const int32 Bone = BoneMap[LocalBoneIndex];
+                    if (Bone >= NumBones) continue;
+
+                    int32 Existing = 0;
+                    while (Existing < NumInfluences && Bones[Existing] != Bone) ++Existing;
+                    if (Existing == NumInfluences)
+                    {
+                        Bones[NumInfluences] = Bone;
+                        RawWeights[NumInfluences] = 0;
+                        ++NumInfluences;
+                    }
+                    RawWeights[Existing] += RawWeight;
+                }
+
+                for (int32 InfluenceIdx = 0; InfluenceIdx < NumInfluences; ++InfluenceIdx)
+                {
+                    Visit(static_cast<int32>(VertexIndex), Bones[InfluenceIdx], RawWeights[InfluenceIdx]);
+                }
+            }
+        }
+    };
+
+    // 1차: 본별 개수 -> 누적 오프셋
+    BoneOffsets.SetNumZeroed(NumBones + 1);
+    ForEachVertexInfluence([this](int32 VertexIndex, int32 Bone, uint32 RawWeight)
+    {
+        ++BoneOffsets[Bone + 1];
+    });
+    for (int32 Bone = 0; Bone < NumBones; ++Bone)
+    {
+        BoneOffsets[Bone + 1] += BoneOffsets[Bone];
+    }
+
+    // 2차: 본 구간에 버텍스/가중치 기록. 섹션과 버텍스를 오름차순으로 돌므로 구간 안도 버텍스 오름차순
+    const int32 NumEntries = BoneOffsets[NumBones];
+    VertexIndices.SetNumUninitialized(NumEntries);
+    VertexWeights.SetNumUninitialized(NumEntries);
+
+    TArray<int32> Cursor(BoneOffsets.GetData(), NumBones);
+    ForEachVertexInfluence([this, &Cursor](int32 VertexIndex, int32 Bone, uint32 RawWeight)
+    {
+        const int32 Entry = Cursor[Bone]++;
+        VertexIndices[Entry] = VertexIndex;
+        VertexWeights[Entry] = static_cast<float>(RawWeight) / 65535.0f;
+    });
+}
+
+void FSkeletalMeshLODSourceData::Build(const FSkeletalMeshLODRenderData& LODRenderData)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(FSkeletalMeshLODSourceData::Build);
+
+    const FStaticMeshVertexBuffers& StaticVertexBuffers = LODRenderData.StaticVertexBuffers;
+    const int32 NumVerts = StaticVertexBuffers.PositionVertexBuffer.GetNumVertices();
+
+    Positions.SetNumUninitialized(NumVerts);
+    TangentsX.SetNumUninitialized(NumVerts);
+    TangentsZ.SetNumUninitialized(NumVerts);
+    UV0.SetNumUninitialized(NumVerts);
+    for (int32 VertexIndex = 0; VertexIndex < NumVerts; ++VertexIndex)
+    {
+        Positions[VertexIndex] = StaticVertexBuffers.PositionVertexBuffer.VertexPosition(VertexIndex);
+        TangentsX[VertexIndex] = FVector3f(StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentX(VertexIndex));
+        TangentsZ[VertexIndex] = StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentZ(VertexIndex);
+        UV0[VertexIndex] = StaticVertexBuffers.StaticMeshVertexBuffer.GetVertexUV(VertexIndex, 0);
+    }
+
+    Colors.Reset();
+    const FColorVertexBuffer& ColorBuffer = StaticVertexBuffers.ColorVertexBuffer;
+    if (ColorBuffer.IsInitialized() && ColorBuffer.GetNumVertices() >= static_cast<uint32>(NumVerts))
+    {
+        Colors.SetNumUninitialized(NumVerts);
+        for (int32 VertexIndex = 0; VertexIndex < NumVerts; ++VertexIndex)
+        {
+            Colors[VertexIndex] = ColorBuffer.VertexColor(VertexIndex);
+        }
+    }
+
+    Indices.Reset();
+    LODRenderData.MultiSizeIndexContainer.GetIndexBuffer(Indices);
+
+    Sections.SetNum(LODRenderData.RenderSections.Num());
+    for (int32 SectionIdx = 0; SectionIdx < Sections.Num(); ++SectionIdx)
+    {
+        const FSkelMeshRenderSection& RenderSection = LODRenderData.RenderSections[SectionIdx];
+        Sections[SectionIdx].MaterialIndex = RenderSection.MaterialIndex;
+        Sections[SectionIdx].BaseIndex = RenderSection.BaseIndex;
+        Sections[SectionIdx].NumTriangles = RenderSection.NumTriangles;
+    }
+
+    // 스킨 웨이트: 섹션 로컬 본 인덱스를 스켈레톤 본 인덱스로 바꿔 고정 폭 슬롯에 기록
+    const FSkinWeightVertexBuffer* SkinWeightBuffer = LODRenderData.GetSkinWeightVertexBuffer();
+    MaxInfluences = SkinWeightBuffer ? FMath::Min<int32>(SkinWeightBuffer->GetMaxBoneInfluences(), MAX_TOTAL_INFLUENCES) : 0;
+    InfluenceBones.SetNumZeroed(NumVerts * MaxInfluences);
+    InfluenceWeights.SetNumZeroed(NumVerts * MaxInfluences);
+    if (MaxInfluences == 0)
+    {
+        return;
+    }
+
+    for (const FSkelMeshRenderSection& Section : LODRenderData.RenderSections)
+    {
+        const TArray<FBoneIndexType>& BoneMap = Section.BoneMap;
+        for (uint32 VertexInSection = 0; VertexInSection < Section.NumVertices; ++VertexInSection)
+        {
+            const uint32 VertexIndex = Section.BaseVertexIndex + VertexInSection;
+            if (VertexIndex >= static_cast<uint32>(NumVerts) || VertexIndex >= SkinWeightBuffer->GetNumVertices()) continue;
+
+            for (int32 InfluenceIdx = 0; InfluenceIdx < MaxInfluences; ++InfluenceIdx)
+            {
+                const uint16 RawWeight = SkinWeightBuffer->GetBoneWeight(VertexIndex, InfluenceIdx);
+                const uint32 LocalBoneIndex = SkinWeightBuffer->GetBoneIndex(VertexIndex, InfluenceIdx);
+                if (RawWeight == 0 || !BoneMap.IsValidIndex(LocalBoneIndex)) continue;
+
+                const int32 Slot = VertexIndex * MaxInfluences + InfluenceIdx;
+                InfluenceBones[Slot] = BoneMap[LocalBoneIndex];
+                InfluenceWeights[Slot] = static_cast<float>(RawWeight) / 65535.0f;
+            }
+        }
+    }
+}
+
+USkeletalMeshInfluenceSubsystem* USkeletalMeshInfluenceSubsystem::Get()
+{
+    return GEngine ? GEngine->GetEngineSubsystem<USkeletalMeshInfluenceSubsystem>() : nullptr;
+}
+
+void USkeletalMeshInfluenceSubsystem::Deinitialize()
+{
+#if WITH_EDITOR
+    for (const TPair<TObjectKey<USkeletalMesh>, FDelegateHandle>& Pair : MeshRebuildHandles)
+    {
+        if (USkeletalMesh* SkeletalMesh = Pair.Key.ResolveObjectPtr())
+        {
+            SkeletalMesh->OnPostMeshCached().Remove(Pair.Value);
+        }
+    }
+    MeshRebuildHandles.Empty();
+#endif
+
+    {
+        FScopeLock Lock(&CacheLock);
+        InfluenceIndices.Empty();
+        LODSourceData.Empty();
+    }
+    Super::Deinitialize();
+}
+
+USkeletalMeshInfluenceSubsystem::FInfluenceIndexPtr USkeletalMeshInfluenceSubsystem::GetInfluenceIndex(const USkeletalMesh* SkeletalMesh, int32 LODIndex)
+{
+    check(IsInGameThread());
+    if (!SkeletalMesh) return nullptr;
+
+    FSkeletalMeshRenderData* RenderData = SkeletalMesh->GetResourceForRendering();
+    if (!RenderData || !RenderData->LODRenderData.IsValidIndex(LODIndex)) return nullptr;
+
+    const FCacheKey Key(TObjectKey<USkeletalMesh>(SkeletalMesh), LODIndex);
+
+    FScopeLock Lock(&CacheLock);
+    // 에디터에서 메시가 다시 빌드되면 재빌드 델리게이트가 항목을 지우므로 그때만 다시 만듦
+    if (const FInfluenceIndexPtr* Cached = InfluenceIndices.Find(Key))
+    {
+        return *Cached;
+    }
+    PurgeStaleEntries();
+
+    TSharedPtr<FSkeletalMeshBoneInfluenceIndex, ESPMode::ThreadSafe> NewIndex = MakeShared<FSkeletalMeshBoneInfluenceIndex, ESPMode::ThreadSafe>();
+    NewIndex->Build(RenderData->LODRenderData[LODIndex], SkeletalMesh->GetRefSkeleton().GetNum());
+    if (NewIndex->NumVertices == 0)
+    {
+        return nullptr;
+    }
+
+    UE_LOG(LogAdvancedAction, Log, TEXT("SkeletalMeshInfluenceSubsystem: '%s' LOD %d 인플루언스 색인 빌드 (%d vertices, %d entries, %llu bytes)"),
+        *SkeletalMesh->GetName(), LODIndex, NewIndex->NumVertices, NewIndex->VertexIndices.Num(), static_cast<uint64>(NewIndex->GetAllocatedSize()));
+
+    InfluenceIndices.Add(Key, NewIndex);
+#if WITH_EDITOR
+    WatchMeshRebuild(SkeletalMesh);
+#endif
+    return NewIndex;
+}
+
+USkeletalMeshInfluenceSubsystem::FLODSourceDataPtr USkeletalMeshInfluenceSubsystem::GetLODSourceData(const USkeletalMesh* SkeletalMesh, int32 LODIndex)
+{
+    check(IsInGameThread());
+    if (!SkeletalMesh) return nullptr;
+
+    FSkeletalMeshRenderData* RenderData = SkeletalMesh->GetResourceForRendering();
+    if (!RenderData || !RenderData->LODRenderData.IsValidIndex(LODIndex)) return nullptr;
+
+    const FCacheKey Key(TObjectKey<USkeletalMesh>(SkeletalMesh), LODIndex);
+
+    FScopeLock Lock(&CacheLock);
+    if (const FLODSourceDataPtr* Cached = LODSourceData.Find(Key))
+    {
+        return *Cached;
+    }
+    PurgeStaleEntries();
+
+    TSharedPtr<FSkeletalMeshLODSourceData, ESPMode::ThreadSafe> NewSourceData = MakeShared<FSkeletalMeshLODSourceData, ESPMode::ThreadSafe>();
+    NewSourceData->Build(RenderData->LODRenderData[LODIndex]);
+    if (NewSourceData->NumVertices() == 0)
+    {
+        return nullptr;
+    }
+
+    UE_LOG(LogAdvancedAction, Log, TEXT("SkeletalMeshInfluenceSubsystem: '%s' LOD %d 렌더 데이터 사본 빌드 (%d vertices, %d indices, %llu bytes)"),
+        *SkeletalMesh->GetName(), LODIndex, NewSourceData->NumVertices(), NewSourceData->Indices.Num(), static_cast<uint64>(NewSourceData->GetAllocatedSize()));
+
+    LODSourceData.Add(Key, NewSourceData);
+#if WITH_EDITOR
+    WatchMeshRebuild(SkeletalMesh);
+#endif
+    return NewSourceData;
+}
+
+void USkeletalMeshInfluenceSubsystem::InvalidateMesh(const USkeletalMesh* SkeletalMesh)
+{
+    const TObjectKey<USkeletalMesh> MeshKey(SkeletalMesh);
+
+    FScopeLock Lock(&CacheLock);
+    for (auto It = InfluenceIndices.CreateIterator(); It; ++It)
+    {
+        if (It.Key().Key == MeshKey)
+        {
+            It.RemoveCurrent();
+        }
+    }
+    for (auto It = LODSourceData.CreateIterator(); It; ++It)
+    {
+        if (It.Key().Key == MeshKey)
+        {
+            It.RemoveCurrent();
+        }
+    }
+}
+
+void USkeletalMeshInfluenceSubsystem::PurgeStaleEntries()
+{
+#if WITH_EDITOR
+    // 사라진 메시의 델리게이트는 메시와 함께 없어지므로 핸들만 버림
+    for (auto It = MeshRebuildHandles.CreateIterator(); It; ++It)
+    {
+        if (!It.Key().ResolveObjectPtr())
+        {
+            It.RemoveCurrent();
+        }
+    }
+#endif
+    for (auto It = InfluenceIndices.CreateIterator(); It; ++It)
+    {
+        if (!It.Key().Key.ResolveObjectPtr())
+        {
+            It.RemoveCurrent();
+        }
+    }
+    for (auto It = LODSourceData.CreateIterator(); It; ++It)
+    {
+        if (!It.Key().Key.ResolveObjectPtr())
+        {
+            It.RemoveCurrent();
+        }
+    }
+}
+
+#if WITH_EDITOR
+void USkeletalMeshInfluenceSubsystem::WatchMeshRebuild(const USkeletalMesh* SkeletalMesh)
+{
+    const TObjectKey<USkeletalMesh> MeshKey(SkeletalMesh);
+    if (MeshRebuildHandles.Contains(MeshKey))
+    {
+        return;
+    }
+
+    // 렌더 데이터 주소는 재빌드 후 재사용될 수 있으므로 비교하지 않고, 재빌드 완료 시점에 항목을 지움
+    USkeletalMesh* MutableMesh = const_cast<USkeletalMesh*>(SkeletalMesh);
+    const FDelegateHandle Handle = MutableMesh->OnPostMeshCached().AddWeakLambda(this, [this](USkeletalMesh* RebuiltMesh)
+    {
+        InvalidateMesh(RebuiltMesh);
+    });
+    MeshRebuildHandles.Add(MeshKey, Handle);
+}
+#endif
@@ -0,0 +1,147 @@
+#include "ProcMeshSkinning.h"
+
+#include "GPUSkinPublicDefs.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace ProcMeshSkinningTest
+{
+    // 합성 메시 크기. 4/8 슬롯 모두 슬롯 수보다 많은 인플루언스(잘라내기)와 적은 인플루언스(빈 슬롯)를 섞음
+    constexpr int32 NumVertices = 2048;
+    constexpr int32 NumBones = 48;
+
+    // 위치 허용 오차 (cm). 바인드 위치는 ±100cm, 팔레트 이동은 ±50cm 범위
+    constexpr float PositionTolerance = 0.01f;
+
+    // 패킹 탄젠트 허용 오차 (성분당 8비트 양자화 두 단계)
+    constexpr float TangentTolerance = 2.0f / 127.0f;
+
+    /** 무작위 인플루언스와 직교 탄젠트 프레임을 가진 팔레트 압축된 버퍼를 만듭니다. */
+    void BuildSyntheticBuffer(FRandomStream& Random, int32 SourceMaxInfluences, FProcMeshSkinningBuffer& OutBuffer)
+    {
+        OutBuffer.Init(NumVertices, SourceMaxInfluences);
+
+        uint16 Bones[MAX_TOTAL_INFLUENCES];
+        float Weights[MAX_TOTAL_INFLUENCES];
+        for (int32 VertexIdx = 0; VertexIdx < NumVertices; ++VertexIdx)
+        {
+            OutBuffer.BindPositions[VertexIdx] = FVector3f(Random.VRand() * Random.FRandRange(0.0f, 100.0f));
+
+            const FVector3f TangentZ(Random.VRand());
+            const FVector3f TangentX = (FVector3f(Random.VRand()) ^ TangentZ).GetSafeNormal(UE_SMALL_NUMBER, FVector3f::ForwardVector);
+            OutBuffer.SetBindTangentFrame(VertexIdx, TangentX, TangentZ, Random.FRand() < 0.5f);
+
+            const int32 NumInfluences = Random.RandRange(1, MAX_TOTAL_INFLUENCES);
+            for (int32 InfluenceIdx = 0; InfluenceIdx < NumInfluences; ++InfluenceIdx)
+            {
+                Bones[InfluenceIdx] = static_cast<uint16>(Random.RandRange(0, NumBones - 1));
+                Weights[InfluenceIdx] = Random.FRandRange(0.01f, 1.0f);
+            }
+            OutBuffer.SetVertexInfluences(VertexIdx, Bones, Weights, NumInfluences);
+        }
+
+        OutBuffer.CompactBonePalette();
+    }
+
+    /** 팔레트 본마다 회전, 이동, 균등 스케일을 가진 무작위 스킨 행렬을 만듭니다. */
+    void BuildRandomPalette(FRandomStream& Random, const FProcMeshSkinningBuffer& Buffer, TArray<FMatrix44f>& OutPalette)
+    {
+        OutPalette.SetNumUninitialized(Buffer.PaletteBones.Num());
+        for (FMatrix44f& SkinMatrix : OutPalette)
+        {
+            const FQuat4f Rotation(FVector3f(Random.VRand()), Random.FRandRange(-UE_PI, UE_PI));
+            const FVector3f Translation(Random.VRand() * Random.FRandRange(0.0f, 50.0f));
+            const FVector3f Scale(Random.FRandRange(0.8f, 1.2f));
+            SkinMatrix = FTransform3f(Rotation, Translation, Scale).ToMatrixWithScale();
+        }
+    }
+
+    bool TangentsMatch(const FPackedNormal& A, const FPackedNormal& B, bool bCompareW)
+    {
+        const FVector4f UnpackedA = A.ToFVector4f();
+        const FVector4f UnpackedB = B.ToFVector4f();
+        return FMath::Abs(UnpackedA.X - UnpackedB.X) <= TangentTolerance
+            && FMath::Abs(UnpackedA.Y - UnpackedB.Y) <= TangentTolerance
+            && FMath::Abs(UnpackedA.Z - UnpackedB.Z) <= TangentTolerance
+            && (!bCompareW || A.Vector.W == B.Vector.W);
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FProcMeshSkinningSimdMatchesScalarTest, "AdvancedAction.Skinning.SimdMatchesScalar",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FProcMeshSkinningSimdMatchesScalarTest::RunTest(const FString& Parameters)
+{
+    using namespace ProcMeshSkinningTest;
+
+    for (const int32 SourceMaxInfluences : { 4, 8 })
+    {
+        FRandomStream Random(0x5EED + SourceMaxInfluences);
+
+        FProcMeshSkinningBuffer Buffer;
+        BuildSyntheticBuffer(Random, SourceMaxInfluences, Buffer);
+        if (!TestEqual(TEXT("InfluencesPerVertex"), Buffer.InfluencesPerVertex, SourceMaxInfluences))
+        {
+            continue;
+        }
+
+        TArray<FMatrix44f> Palette;
+        BuildRandomPalette(Random, Buffer, Palette);
+
+        TArray<FVector3f> ScalarPositions;
+        TArray<FVector3f> SimdPositions;
+        TArray<FPackedNormal> ScalarTangents;
+        TArray<FPackedNormal> SimdTangents;
+        ScalarPositions.SetNumUninitialized(NumVertices);
+        SimdPositions.SetNumUninitialized(NumVertices);
+        ScalarTangents.SetNumUninitialized(NumVertices * 2);
+        SimdTangents.SetNumUninitialized(NumVertices * 2);
+
+        ProcMeshSkinning::SkinVerticesScalar(Buffer, Palette.GetData(), 0, NumVertices, ScalarPositions.GetData(), ScalarTangents.GetData());
+        ProcMeshSkinning::SkinVerticesSimd(Buffer, Palette.GetData(), 0, NumVertices, SimdPositions.GetData(), SimdTangents.GetData());
+
+        int32 NumPositionMismatches = 0;
+        int32 NumTangentMismatches = 0;
+        for (int32 VertexIdx = 0; VertexIdx < NumVertices; ++VertexIdx)
+        {
+            if (FVector3f::Dist(ScalarPositions[VertexIdx], SimdPositions[VertexIdx]) > PositionTolerance)
+            {
+                ++NumPositionMismatches;
+            }
+            if (!TangentsMatch(ScalarTangents[VertexIdx * 2 + 0], SimdTangents[VertexIdx * 2 + 0], false)
+                || !TangentsMatch(ScalarTangents[VertexIdx * 2 + 1], SimdTangents[VertexIdx * 2 + 1], true))
+            {
+                ++NumTangentMismatches;
+            }
+        }
+        TestEqual(FString::Printf(TEXT("%d slots: positions outside tolerance"), SourceMaxInfluences), NumPositionMismatches, 0);
+        TestEqual(FString::Printf(TEXT("%d slots: packed tangents outside tolerance"), SourceMaxInfluences), NumTangentMismatches, 0);
+
+        // 청크 단위 호출(출력 0번이 StartVertex)도 전체 호출과 같은 결과를 내야 함
+        const int32 StartVertex = NumVertices / 3;
+        const int32 NumChunkVertices = NumVertices / 4;
+        TArray<FVector3f> ChunkPositions;
+        TArray<FPackedNormal> ChunkTangents;
+        ChunkPositions.SetNumUninitialized(NumChunkVertices);
+        ChunkTangents.SetNumUninitialized(NumChunkVertices * 2);
+        ProcMeshSkinning::SkinVerticesSimd(Buffer, Palette.GetData(), StartVertex, NumChunkVertices, ChunkPositions.GetData(), ChunkTangents.GetData());
+
+        int32 NumChunkMismatches = 0;
+        for (int32 OutIdx = 0; OutIdx < NumChunkVertices; ++OutIdx)
+        {
+            if (ChunkPositions[OutIdx] != SimdPositions[StartVertex + OutIdx]
+                || ChunkTangents[OutIdx * 2 + 0].Vector.Packed != SimdTangents[(StartVertex + OutIdx) * 2 + 0].Vector.Packed
+                || ChunkTangents[OutIdx * 2 + 1].Vector.Packed != SimdTangents[(StartVertex + OutIdx) * 2 + 1].Vector.Packed)
+            {
+                ++NumChunkMismatches;
+            }
+        }
+        TestEqual(FString::Printf(TEXT("%d slots: chunked output differs from full output"), SourceMaxInfluences), NumChunkMismatches, 0);
+    }
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -4,6 +4,8 @@
 
 #include "Modules/ModuleManager.h"
 
+ADVANCEDACTIONFEATURE_API DECLARE_LOG_CATEGORY_EXTERN(LogAdvancedAction, Log, All);
+
 class FAdvancedActionFeatureModule : public IModuleInterface
 {
 public:
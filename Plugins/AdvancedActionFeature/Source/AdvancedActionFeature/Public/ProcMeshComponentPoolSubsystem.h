@@ -0,0 +1,68 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "ProcMeshComponentPoolSubsystem.generated.h"
+
+class UMeshComponent;
+class UProcMeshPieceComponent;
+
+/**
+ * 절단 조각용 메시 컴포넌트(UProcMeshPieceComponent) 풀 (월드당 하나).
+ * 절단마다 NewObject + RegisterComponent로 조각 컴포넌트를 만들고 조각이 사라질 때 DestroyComponent하면
+ * 생성/등록/렌더 상태 생성 비용이 절단 프레임에 몰리고 GC 대상이 계속 쌓이므로,
+ * 등록된 상태의 컴포넌트를 숨겨 두었다가 절단 시 빌려주고 조각이 사라지면 다시 돌려받습니다.
+ * 풀의 컴포넌트는 모두 월드에 하나 생성되는 풀 액터가 소유하므로, 빌린 컴포넌트는 사용자 액터의 컴포넌트 목록에 나타나지 않고
+ * 빌린 쪽이 EndPlay 등에서 반드시 Release해야 합니다. 크기는 AdvancedAction.Pool.* 콘솔 변수로 조정합니다.
+ */
+UCLASS()
+class ADVANCEDACTIONFEATURE_API UProcMeshComponentPoolSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+
+    /** 월드에 서브시스템이 있고 AdvancedAction.Pool.Enable이 켜져 있으면 반환 */
+    static UProcMeshComponentPoolSubsystem* GetActive(const UWorld* World);
+
+    // UWorldSubsystem
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+    virtual void Deinitialize() override;
+
+    /** 풀에서 컴포넌트를 꺼냅니다. 비어 있으면 새로 만들어 등록합니다. 반환된 컴포넌트는 보이는 상태이고 섹션이 없습니다. */
+    UProcMeshPieceComponent* Acquire();
+
+    /** 컴포넌트를 분리하고 섹션/머티리얼/충돌을 비워 풀에 돌려줍니다. 풀이 가득 찼거나 풀 소유가 아니면 파괴합니다. */
+    void Release(UProcMeshPieceComponent* Component);
+
+    /** 풀 액터가 소유한 컴포넌트인지 (사용자 액터가 가진 컴포넌트는 Release 대신 직접 관리) */
+    bool IsPooled(const UMeshComponent* Component) const;
+
+    /** 풀에 대기 중인 컴포넌트가 Count개가 되도록 미리 만들어 둡니다. */
+    void Prewarm(int32 Count);
+
+    int32 GetNumFree() const { return FreeComponents.Num(); }
+
+protected:
+
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+
+    /** 풀 액터 아래에 새 컴포넌트를 만들어 등록합니다. */
+    UProcMeshPieceComponent* CreatePooledComponent();
+
+    /** 숨김/충돌 해제 상태로 바꿉니다. */
+    static void Deactivate(UProcMeshPieceComponent& Component);
+
+    // 풀 컴포넌트를 소유하는 숨은 액터 (처음 필요할 때 생성)
+    UPROPERTY(Transient)
+    TObjectPtr<AActor> PoolActor;
+
+    // 대기 중인 컴포넌트
+    UPROPERTY(Transient)
+    TArray<TObjectPtr<UProcMeshPieceComponent>> FreeComponents;
+};
@@ -0,0 +1,25 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+
+#include "ProcMeshCutBakeCommandlet.generated.h"
+
+/**
+ * UProcMeshCutBakedData 에셋을 다시 베이크하고 저장하는 커맨드렛.
+ * 사용법: UnrealEditor-Cmd <Project> -run=ProcMeshCutBake [-Asset=/Game/Path/Asset] [-NoSave]
+ * -Asset이 없으면 프로젝트의 모든 UProcMeshCutBakedData 에셋을 처리합니다.
+ */
+UCLASS()
+class ADVANCEDACTIONFEATURE_API UProcMeshCutBakeCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+
+    UProcMeshCutBakeCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+};
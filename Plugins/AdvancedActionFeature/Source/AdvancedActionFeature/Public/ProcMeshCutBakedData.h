@@ -0,0 +1,149 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "ProcMeshSkinning.h"
+
+#include "ProcMeshCutBakedData.generated.h"
+
+class USkeletalMesh;
+struct FProcMeshCutResult;
+
+/** 베이크된 조각의 섹션 하나 (UPROPERTY는 중첩 배열을 담을 수 없으므로 감쌈) */
+USTRUCT()
+struct FProcMeshBakedSection
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    TArray<int32> Indices;
+};
+
+/** 베이크된 조각 하나 (슬라이스된 절반의 지오메트리 + 팔레트 압축이 끝난 스키닝 데이터) */
+USTRUCT()
+struct FProcMeshBakedPiece
+{
+    GENERATED_BODY()
+
+    // 절단 평면의 음(-)쪽 절반인지
+    UPROPERTY()
+    bool bIsOtherHalf = false;
+
+    UPROPERTY()
+    TArray<FVector> Vertices;
+
+    UPROPERTY()
+    TArray<FVector> Normals;
+
+    // TangentX
+    UPROPERTY()
+    TArray<FVector> Tangents;
+
+    // 버텍스별 FProcMeshTangent::bFlipTangentY (Tangents와 같은 크기)
+    UPROPERTY()
+    TArray<bool> TangentFlipY;
+
+    UPROPERTY()
+    TArray<FVector2D> UV0;
+
+    UPROPERTY()
+    TArray<FLinearColor> VertexColors;
+
+    // 원본 LOD 섹션 순서, 캡이 있으면 마지막
+    UPROPERTY()
+    TArray<FProcMeshBakedSection> Sections;
+
+    UPROPERTY()
+    int32 CapSectionIndex = INDEX_NONE;
+
+    UPROPERTY()
+    FProcMeshSkinningBuffer SkinningData;
+};
+
+/** 본 하나를 단독으로 절단한 결과 */
+USTRUCT()
+struct FProcMeshBakedBoneCut
+{
+    GENERATED_BODY()
+
+    UPROPERTY(VisibleAnywhere, Category = "Bake")
+    FName BoneName;
+
+    // 슬라이스 전 버텍스 -> 원본 LOD 버텍스 (원본 메시에서 숨길 버텍스이기도 함)
+    UPROPERTY()
+    TArray<int32> SourceVertexIndices;
+
+    UPROPERTY()
+    TArray<FProcMeshBakedPiece> Pieces;
+};
+
+/**
+ * 스켈레탈 메시 LOD 하나에 대해 본별 절단 결과(조각 지오메트리, 캡, 패킹된 스키닝 데이터)를 미리 계산해 둔 에셋.
+ * 절단 결과는 메시/LOD/본/옵션이 같으면 항상 같으므로, USkelToProcMeshComponent는 맞는 에셋이 있으면
+ * 버텍스 선택과 슬라이스를 건너뛰고 여기서 바로 조각을 만듭니다. 맞지 않으면 런타임 생성으로 돌아갑니다.
+ * 에디터에서는 Bake 버튼으로, 빌드 머신에서는 ProcMeshCutBake 커맨드렛으로 다시 베이크합니다.
+ */
+UCLASS(BlueprintType)
+class ADVANCEDACTIONFEATURE_API UProcMeshCutBakedData : public UDataAsset
+{
+    GENERATED_BODY()
+
+public:
+
+    // --- 베이크 입력 (컴포넌트 설정과 같아야 런타임에 사용됨) ---
+
+    UPROPERTY(EditAnywhere, Category = "Bake")
+    TObjectPtr<USkeletalMesh> SkeletalMesh;
+
+    UPROPERTY(EditAnywhere, Category = "Bake", meta = (ClampMin = "0"))
+    int32 LODIndex = 0;
+
+    // 비어 있으면 가중치를 가진 모든 본을 베이크
+    UPROPERTY(EditAnywhere, Category = "Bake")
+    TArray<FName> BonesToBake;
+
+    UPROPERTY(EditAnywhere, Category = "Bake")
+    float Threshold = 0.01f;
+
+    UPROPERTY(EditAnywhere, Category = "Bake")
+    bool bCutBoneSubtree = true;
+
+    UPROPERTY(EditAnywhere, Category = "Bake")
+    bool bRecalculateNormals = false;
+
+    UPROPERTY(EditAnywhere, Category = "Bake")
+    bool bCopyVertexColors = true;
+
+    // --- 베이크 결과 ---
+
+    // 베이크한 LOD의 버텍스 수 (메시가 다시 임포트되었는지 확인용)
+    UPROPERTY(VisibleAnywhere, Category = "Baked")
+    int32 NumSourceVertices = 0;
+
+    // 섹션별 머티리얼 인덱스 (캡 섹션 제외)
+    UPROPERTY(VisibleAnywhere, Category = "Baked")
+    TArray<int32> SectionMaterialIndices;
+
+    UPROPERTY(VisibleAnywhere, Category = "Baked")
+    TArray<FProcMeshBakedBoneCut> BoneCuts;
+
+    /** 메시/LOD/옵션이 베이크 입력과 같고 메시 버텍스 수가 그대로인지 */
+    bool Matches(const USkeletalMesh* InSkeletalMesh, int32 InLODIndex, float InThreshold, bool bInCutBoneSubtree, bool bInRecalculateNormals, bool bInCopyVertexColors) const;
+
+    const FProcMeshBakedBoneCut* FindBoneCut(FName BoneName) const;
+
+    /**
+     * 베이크된 본 절단들로 절단 결과를 채웁니다. 본별로 단독 절단한 결과이므로
+     * 요청한 본들이 원본 버텍스를 공유하면(런타임에서는 가중치 비교가 필요) 실패합니다.
+     * @return 모든 본이 베이크되어 있고 서로 겹치지 않으면 true
+     */
+    bool BuildCutResult(TConstArrayView<FName> TargetBoneNames, FProcMeshCutResult& OutResult) const;
+
+#if WITH_EDITOR
+    /** 현재 입력으로 모든 본 절단을 다시 계산합니다. 메시 렌더 데이터가 필요합니다. */
+    UFUNCTION(CallInEditor, Category = "Bake")
+    void Bake();
+#endif
+};
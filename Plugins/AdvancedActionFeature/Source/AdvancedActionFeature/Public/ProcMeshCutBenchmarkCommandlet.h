@@ -0,0 +1,28 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+
+#include "ProcMeshCutBenchmarkCommandlet.generated.h"
+
+/**
+ * 절단/스키닝 파이프라인의 단계별 시간을 재는 헤드리스 벤치마크 커맨드렛. GPU가 없는 빌드 머신에서 회귀 확인용으로 씁니다.
+ * 메시의 LOD/본 조합마다 절단을 만들고(추출, 리맵, 탄젠트, 슬라이스, 스키닝 데이터, 숨김 컬러),
+ * 그 조각들을 합성 포즈로 N 프레임 스키닝(팔레트, 커널)한 결과를 CSV 또는 JSON(.json 확장자)으로 저장합니다.
+ * 사용법: UnrealEditor-Cmd <Project> -run=ProcMeshCutBenchmark -nullrhi -Mesh=/Game/Path/Mesh
+ *         [-LOD=<인덱스>] [-Bones=a,b] [-Frames=60] [-Repeat=3] [-Threshold=0.01] [-NoSubtree] [-NoTangents] [-Output=<경로>]
+ * -LOD가 없으면 모든 LOD, -Bones가 없으면 모든 본을 측정하며, 기본 출력은 Saved/Profiling/ProcMeshCutBenchmark.csv입니다.
+ */
+UCLASS()
+class ADVANCEDACTIONFEATURE_API UProcMeshCutBenchmarkCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+
+    UProcMeshCutBenchmarkCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,81 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "ProcMeshCutBudgetSubsystem.generated.h"
+
+class USkelToProcMeshComponent;
+
+/**
+ * 월드 안의 모든 절단 조각과 절단 요청을 관리하는 예산 관리자.
+ * 컴포넌트마다 따로 절단/스키닝하면 한 프레임에 절단 수십 개, 스키닝 버텍스 수십만 개가 몰릴 수 있으므로
+ * - 비동기 절단 요청은 큐에 모아 프레임마다 개수/게임 스레드 시간 예산 안에서만 시작하고,
+ * - 조각을 가진 컴포넌트의 스키닝은 프레임마다 버텍스 예산 안에서 우선순위가 높은 것부터 허가합니다.
+ * 우선순위는 가장 가까운 시점 기준 화면 크기(바운드 반지름 / 거리)이며, 이번 프레임에 밀린 컴포넌트는
+ * 기다린 프레임 수만큼 가중되어 결국 모두 갱신됩니다. 예산은 AdvancedAction.Budget.* 콘솔 변수로 조정합니다.
+ * 동기 절단 API(ConvertSkeletalMeshToProceduralMesh/Batch)는 호출자가 즉시 결과를 요구하므로 큐를 거치지 않습니다.
+ */
+UCLASS()
+class ADVANCEDACTIONFEATURE_API UProcMeshCutBudgetSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+
+    /** 월드에 서브시스템이 있고 AdvancedAction.Budget.Enable이 켜져 있으면 반환 */
+    static UProcMeshCutBudgetSubsystem* GetActive(const UWorld* World);
+
+    // UTickableWorldSubsystem
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    /** 절단 요청을 큐에 넣습니다. 같은 컴포넌트의 대기 중인 요청은 새 요청으로 대체됩니다. */
+    void QueueCut(USkelToProcMeshComponent* Component, bool bForceNewPMC, TConstArrayView<FName> TargetBoneNames);
+
+    /** 컴포넌트의 대기 중인 절단 요청을 제거합니다. */
+    void RemoveQueuedCut(const USkelToProcMeshComponent* Component);
+
+    /** 조각을 가진 컴포넌트를 스키닝 예산 대상으로 등록/해제합니다. 대기 중인 절단 요청은 건드리지 않습니다. (RemoveQueuedCut) */
+    void RegisterComponent(USkelToProcMeshComponent* Component);
+    void UnregisterComponent(USkelToProcMeshComponent* Component);
+
+    int32 GetNumQueuedCuts() const { return QueuedCuts.Num(); }
+
+protected:
+
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+
+    struct FQueuedCut
+    {
+        TWeakObjectPtr<USkelToProcMeshComponent> Component;
+        TArray<FName> TargetBoneNames;
+        bool bForceNewPMC = false;
+
+        // 같은 우선순위면 먼저 들어온 요청부터
+        uint64 Sequence = 0;
+        float Priority = 0.f;
+    };
+
+    /** 큐에서 우선순위 순으로 예산 안의 절단을 시작합니다. */
+    void DispatchQueuedCuts();
+
+    /** 다음 프레임의 스키닝 허가를 버텍스 예산 안에서 배분합니다. */
+    void AllocateSkinningBudget();
+
+    /** 플레이어 시점 기준 화면 크기 점수. 시점이 없으면(전용 서버 등) 1 */
+    float ComputeScreenPriority(const USkelToProcMeshComponent& Component) const;
+
+    TArray<FQueuedCut> QueuedCuts;
+    uint64 NextQueueSequence = 0;
+
+    TArray<TWeakObjectPtr<USkelToProcMeshComponent>> RegisteredComponents;
+
+    // 이번 틱의 플레이어 시점 위치 (Tick 시작 시 갱신)
+    TArray<FVector> ViewLocations;
+};
@@ -0,0 +1,132 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/MeshComponent.h"
+#include "ProceduralMeshComponent.h"
+#include "PackedNormal.h"
+#include <atomic>
+
+#include "ProcMeshPieceComponent.generated.h"
+
+/**
+ * 게임 스레드가 채워 렌더 스레드로 넘기는 스키닝 결과 한 프레임.
+ * 섹션 순서로 이어 붙인 스트림이며, 배열은 링 슬롯에 남아 프레임 사이에 재사용됩니다.
+ */
+struct FProcMeshPieceSkinnedFrame
+{
+    // 컴포넌트 로컬 공간 위치
+    TArray<FVector3f> Positions;
+
+    // 버텍스마다 TangentX, TangentZ 두 개 (TangentZ.W에 바이노멀 부호). 프록시 탄젠트 버퍼 레이아웃과 같아 그대로 복사됨
+    TArray<FPackedNormal> Tangents;
+
+    // 섹션 S의 버텍스는 [SectionVertexOffsets[S], SectionVertexOffsets[S + 1])
+    TArray<int32> SectionVertexOffsets;
+
+    // 렌더 스레드가 아직 읽지 않은 제출 수. 0일 때만 게임 스레드가 다시 씀
+    std::atomic<int32> NumPendingReads { 0 };
+
+    int32 Num() const { return Positions.Num(); }
+};
+
+/**
+ * 절단 조각 전용 메시 컴포넌트.
+ * 섹션 데이터는 UProceduralMeshComponent와 같은 FProcMeshSection으로 보관하지만, 전용 씬 프록시가
+ * 섹션마다 영구적인 정점 버퍼를 두고 매 틱 위치/탄젠트 버퍼(BUF_Dynamic)만 덮어씁니다.
+ * (UpdateMeshSection은 틱마다 배열 할당, FProcMeshVertex 변환, 섹션 전체 재생성 명령을 만듦)
+ * 게임 스레드는 고정 크기 링의 빈 슬롯에 스키닝 결과를 쓰고 렌더 명령으로 슬롯을 넘기며, 렌더 스레드가 다 읽은 슬롯만 재사용하므로 락이 없습니다.
+ * UProceduralMeshComponent를 상속하지 않는 이유: 상속한 UpdateMeshSection* / SetMeshSectionVisible(BlueprintCallable)이
+ * 씬 프록시를 FProceduralMeshSceneProxy로 캐스팅해 이 프록시의 메모리를 덮어쓰기 때문에, 이 프록시가 지원하는 API만 노출합니다.
+ * 섹션 충돌은 만들지 않습니다. (조각은 bCreateCollision 없이 섹션을 만들어 왔음)
+ */
+UCLASS(ClassGroup = Rendering)
+class ADVANCEDACTIONFEATURE_API UProcMeshPieceComponent : public UMeshComponent
+{
+    GENERATED_BODY()
+
+public:
+
+    // 링 슬롯 수. 렌더 스레드가 이만큼 밀리면 그 프레임의 제출을 건너뜀 (bWaitForFreeSlot 제외)
+    static constexpr int32 NumSkinnedFrames = 3;
+
+    UProcMeshPieceComponent(const FObjectInitializer& ObjectInitializer);
+
+    // UPrimitiveComponent
+    virtual FPrimitiveSceneProxy* CreateSceneProxy() override;
+
+    // UMeshComponent
+    virtual int32 GetNumMaterials() const override;
+
+    // USceneComponent
+    virtual FBoxSphereBounds CalcBounds(const FTransform& LocalToWorld) const override;
+
+    /**
+     * 섹션을 만들거나 교체합니다. (UProceduralMeshComponent::CreateMeshSection_LinearColor와 같고 충돌만 만들지 않음)
+     * 개수가 버텍스 수와 다른 노멀/UV/컬러/탄젠트 배열은 기본값으로 채웁니다.
+     */
+    void CreateMeshSection_LinearColor(int32 SectionIndex, const TArray<FVector>& Vertices, const TArray<int32>& Triangles, const TArray<FVector>& Normals,
+                                       const TArray<FVector2D>& UV0, const TArray<FLinearColor>& VertexColors, const TArray<FProcMeshTangent>& Tangents);
+
+    /** 모든 섹션을 제거합니다. 섹션 버퍼 용량은 남겨 풀에서 재사용될 때 다시 할당하지 않음 */
+    void ClearAllMeshSections();
+
+    int32 GetNumSections() const { return NumSections; }
+
+    /** 섹션 데이터 (없으면 nullptr). 직접 수정한 뒤에는 SetProcMeshSection으로 다시 넣어야 프록시에 반영됨 */
+    const FProcMeshSection* GetProcMeshSection(int32 SectionIndex) const;
+
+    /** 섹션 데이터를 교체하고 렌더 상태를 다시 만듭니다. */
+    void SetProcMeshSection(int32 SectionIndex, const FProcMeshSection& Section);
+
+    /**
+     * 다음에 쓸 링 슬롯을 NumVertices 크기로 준비해 반환합니다. 렌더 스레드가 모든 슬롯을 읽는 중이면 nullptr
+     * bWaitForFreeSlot이면 대신 렌더 명령을 비워 슬롯을 확보합니다. (멈춤/굳힘처럼 다시 제출되지 않는 프레임용)
+     * 반환된 프레임의 Positions/Tangents를 채운 뒤 SubmitSkinnedFrame으로 넘깁니다.
+     */
+    FProcMeshPieceSkinnedFrame* BeginSkinnedFrame(int32 NumVertices, bool bWaitForFreeSlot = false);
+
+    /** BeginSkinnedFrame으로 채운 프레임을 바운드와 함께 프록시에 보냅니다. 섹션 구간이 섹션 정점 수와 다르면 그 섹션은 건너뜀 */
+    void SubmitSkinnedFrame(FProcMeshPieceSkinnedFrame* Frame, TConstArrayView<int32> SectionVertexOffsets);
+
+    /**
+     * 마지막으로 제출한 프레임을 CPU 섹션 데이터에 써 넣고 링을 해제합니다.
+     * 이후 프록시가 다시 만들어져도 마지막 포즈가 유지됩니다. (조각을 정적으로 굳힐 때 사용)
+     */
+    void BakeSkinnedFrame();
+
+    /** 링을 해제하고 섹션 바운드로 돌아갑니다. 섹션을 새로 만들기 전(재사용, 풀 반납)에 호출해 이전 조각의 프레임이 새 프록시에 적용되지 않게 합니다. */
+    void ResetSkinnedFrames();
+
+    /** 마지막으로 제출한 프레임 (없으면 nullptr). 새 프록시가 만들어질 때 초기 내용으로 씀 */
+    const FProcMeshPieceSkinnedFrame* GetLastSubmittedFrame() const;
+
+private:
+
+    /** 렌더 스레드가 읽고 있지 않고 마지막 제출 슬롯도 아닌 슬롯을 찾아 NextSkinnedFrame으로 정합니다. 없으면 nullptr */
+    FProcMeshPieceSkinnedFrame* FindFreeSkinnedFrame();
+
+    /** 섹션 바운드를 합쳐 LocalBounds를 갱신합니다. */
+    void UpdateLocalBounds();
+
+    /** 섹션을 비우되 정점/인덱스 버퍼 용량은 유지합니다. */
+    static void ResetSection(FProcMeshSection& Section);
+
+    // 조각 섹션 (트랜지언트 컴포넌트라 직렬화하지 않음). 앞의 NumSections개만 사용 중이고 나머지는 비운 채 용량만 유지
+    TArray<FProcMeshSection> ProcMeshSections;
+    int32 NumSections = 0;
+
+    // 섹션 바운드 합 (컴포넌트 로컬 공간)
+    FBoxSphereBounds LocalBounds = FBoxSphereBounds(ForceInit);
+
+    TArray<TSharedRef<FProcMeshPieceSkinnedFrame, ESPMode::ThreadSafe>> SkinnedFrames;
+
+    // 다음에 쓸 슬롯, 마지막으로 제출한 슬롯 (INDEX_NONE이면 없음)
+    int32 NextSkinnedFrame = 0;
+    int32 LastSubmittedFrame = INDEX_NONE;
+
+    // 스키닝 결과 기준 로컬 바운드 (제출한 적이 없으면 섹션 바운드 사용)
+    FBox3f SkinnedLocalBox = FBox3f(ForceInit);
+    bool bHasSkinnedBounds = false;
+};
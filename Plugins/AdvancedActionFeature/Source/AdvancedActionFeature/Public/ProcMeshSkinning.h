@@ -0,0 +1,226 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PackedNormal.h"
+
+#include "ProcMeshSkinning.generated.h"
+
+/**
+ * 가공(슬라이스 등)된 버텍스가 가공 전 메시의 어느 버텍스에서 왔는지.
+ * 그대로 복사된 버텍스는 SourceA만, 절단 에지 위에 새로 생긴 버텍스는 SourceA -> SourceB를 Alpha로 보간한 값입니다.
+ */
+struct FProcMeshVertexProvenance
+{
+    int32 SourceA = INDEX_NONE;
+    int32 SourceB = INDEX_NONE;
+    float Alpha = 0.f;
+
+    FProcMeshVertexProvenance() = default;
+    explicit FProcMeshVertexProvenance(int32 InSource) : SourceA(InSource) {}
+    FProcMeshVertexProvenance(int32 InSourceA, int32 InSourceB, float InAlpha) : SourceA(InSourceA), SourceB(InSourceB), Alpha(InAlpha) {}
+
+    bool IsInterpolated() const { return SourceB != INDEX_NONE; }
+};
+
+/**
+ * 프로시저럴 메시 런타임 스키닝용 패킹 버퍼.
+ * 버텍스마다 TArray 두 개를 들고 있던 기존 구조 대신, 고정 폭 인플루언스 슬롯과
+ * 바인드 포즈 위치/탄젠트 프레임을 각각 연속된 배열(SoA)로 보관합니다.
+ * 인플루언스 배열의 레이아웃은 [VertexIndex * InfluencesPerVertex + Slot] 입니다.
+ */
+USTRUCT()
+struct ADVANCEDACTIONFEATURE_API FProcMeshSkinningBuffer
+{
+    GENERATED_BODY()
+
+    // 버텍스당 인플루언스 슬롯 수 (4 또는 8)
+    UPROPERTY()
+    int32 InfluencesPerVertex = 0;
+
+    // 슬롯별 본 인덱스. 빌드 중에는 스켈레톤(RefSkeleton) 본 인덱스이고,
+    // CompactBonePalette 이후에는 PaletteBones에 대한 로컬 인덱스. 사용하지 않는 슬롯은 0, 가중치 0
+    UPROPERTY()
+    TArray<uint16> BoneIndices;
+
+    // 이 조각이 실제로 참조하는 스켈레톤 본 인덱스 목록 (팔레트 인덱스 -> 스켈레톤 본 인덱스)
+    UPROPERTY()
+    TArray<uint16> PaletteBones;
+
+    // 슬롯별 양자화 가중치. 버텍스 단위 합계가 항상 MaxQuantizedWeight가 되도록 정규화됨
+    UPROPERTY()
+    TArray<uint16> BoneWeights;
+
+    // 바인드 포즈(컴포넌트 공간) 버텍스 위치
+    UPROPERTY()
+    TArray<FVector3f> BindPositions;
+
+    // 바인드 포즈 탄젠트 프레임. 버텍스마다 TangentX, TangentZ(노멀, W에 바이노멀 부호) 순서의 FPackedNormal 두 개이며
+    // 렌더 탄젠트 버퍼와 같은 레이아웃. FPackedNormal은 UPROPERTY로 직렬화할 수 없으므로 Packed 값(uint32)으로 보관
+    UPROPERTY()
+    TArray<uint32> BindTangentFrames;
+
+    static constexpr uint16 MaxQuantizedWeight = 0xFFFF;
+
+    /** 소스 메시의 최대 인플루언스 수를 받아 4/8 슬롯 중 하나로 버퍼를 할당합니다. */
+    void Init(int32 NumVertices, int32 SourceMaxInfluences);
+
+    /** 모든 배열을 해제합니다. */
+    void Reset();
+
+    int32 Num() const { return BindPositions.Num(); }
+    bool IsEmpty() const { return BindPositions.Num() == 0 || InfluencesPerVertex == 0; }
+
+    /** 탄젠트 프레임이 버텍스 수와 맞는지 여부 (탄젠트 프레임 도입 전에 베이크된 데이터는 false) */
+    bool HasBindTangentFrames() const { return BindTangentFrames.Num() == Num() * 2; }
+
+    /** 바인드 포즈 탄젠트 프레임을 패킹해 기록합니다. bFlipTangentY는 FProcMeshTangent와 같은 의미 */
+    void SetBindTangentFrame(int32 VertexIndex, const FVector3f& TangentX, const FVector3f& TangentZ, bool bFlipTangentY);
+
+    FPackedNormal GetBindTangentX(int32 VertexIndex) const
+    {
+        FPackedNormal Packed;
+        Packed.Vector.Packed = BindTangentFrames[VertexIndex * 2 + 0];
+        return Packed;
+    }
+
+    FPackedNormal GetBindTangentZ(int32 VertexIndex) const
+    {
+        FPackedNormal Packed;
+        Packed.Vector.Packed = BindTangentFrames[VertexIndex * 2 + 1];
+        return Packed;
+    }
+
+    /**
+     * 한 버텍스의 인플루언스를 슬롯에 기록합니다.
+     * 슬롯 수보다 많으면 가중치가 큰 순서대로 잘라낸 뒤 재정규화하고 16비트로 양자화합니다.
+     * @return 유효한 인플루언스가 하나라도 기록되었는지 여부
+     */
+    bool SetVertexInfluences(int32 VertexIndex, const uint16* SkeletonBoneIndices, const float* Weights, int32 NumInfluences);
+
+    /**
+     * 가중치가 있는 슬롯이 참조하는 본만 모아 PaletteBones를 만들고,
+     * BoneIndices를 스켈레톤 본 인덱스에서 팔레트 로컬 인덱스로 다시 씁니다. 빌드 마지막에 한 번 호출합니다.
+     */
+    void CompactBonePalette();
+
+    /**
+     * 팔레트 압축이 끝난 Source 버퍼에서 출처 정보를 따라 인플루언스를 전파해 새 버퍼를 만듭니다.
+     * 보간 버텍스는 두 출처의 인플루언스를 (1 - Alpha), Alpha 비율로 합친 뒤 상위 슬롯만 남깁니다.
+     * 바인드 포즈 위치/탄젠트 프레임은 0으로 할당만 되며 호출자가 채워야 합니다.
+     */
+    void InitFromProvenance(const FProcMeshSkinningBuffer& Source, TConstArrayView<FProcMeshVertexProvenance> Provenance);
+
+    /**
+     * Source 버퍼의 버텍스를 SourceVertexIndices 순서로 다시 배치한 버퍼를 만듭니다. (같은 버텍스를 여러 번 참조해도 됨)
+     * 슬롯과 팔레트는 그대로 복사되며 바인드 포즈 값도 함께 옮겨집니다.
+     */
+    void InitFromRemap(const FProcMeshSkinningBuffer& Source, TConstArrayView<int32> SourceVertexIndices);
+
+    /**
+     * 현재 포즈에 대한 스키닝 팔레트를 계산합니다. PaletteBones에 있는 본에 대해서만
+     * (역 바인드 행렬 * 현재 컴포넌트 공간 본 행렬)을 한 번씩 계산합니다.
+     * @param RefBasesInvMatrix 스켈레톤 본별 역 바인드 포즈 행렬 (컴포넌트 공간)
+     * @param ComponentSpaceTransforms 스켈레톤 본별 현재 컴포넌트 공간 트랜스폼
+     * @param OutPalette 팔레트 인덱스 순서의 최종 스킨 행렬
+     */
+    void BuildSkinningPalette(const TArray<FMatrix44f>& RefBasesInvMatrix, const TArray<FTransform>& ComponentSpaceTransforms, TArray<FMatrix44f>& OutPalette) const;
+
+    /** 버퍼가 점유하고 있는 힙 메모리 크기 */
+    SIZE_T GetAllocatedSize() const;
+};
+
+/**
+ * 조각 하나를 스키닝하는 데 필요한 입력과 출력 묶음.
+ * Palette는 게임 스레드에서 채우고, SkinnedPositions/SkinnedTangents는 커널이 (병렬로) 채웁니다.
+ * 커널 출력과 업로드용 결과는 더블 버퍼로 분리되어 있어, 업로드 중에도 다음 스키닝을 돌릴 수 있습니다.
+ * 배열은 틱마다 재사용되므로 조각이 살아있는 동안 재할당이 일어나지 않습니다.
+ */
+struct FProcMeshSkinningJob
+{
+    const FProcMeshSkinningBuffer* Buffer = nullptr;
+    TArray<FMatrix44f> Palette;
+
+    // 커널이 기록하는 백 버퍼. 탄젠트는 버텍스마다 TangentX, TangentZ 두 개 (바인드 탄젠트 프레임과 같은 레이아웃)
+    TArray<FVector3f> SkinnedPositions;
+    TArray<FPackedNormal> SkinnedTangents;
+
+    // 업로드가 읽는 프론트 버퍼
+    TArray<FVector3f> PresentedPositions;
+    TArray<FPackedNormal> PresentedTangents;
+
+    // 직전 프론트 버퍼 (스로틀링된 프레임의 보간용, Present(true)일 때만 유지)
+    // 탄젠트는 보간하지 않고 프론트 버퍼 값을 그대로 씀
+    TArray<FVector3f> PreviousPositions;
+
+    /**
+     * 완료된 커널 출력을 프론트 버퍼로 넘깁니다. (할당 교환만 하므로 복사 없음)
+     * @param bKeepPrevious 이전 프론트 버퍼를 PreviousPositions로 남길지 여부
+     */
+    void Present(bool bKeepPrevious = false)
+    {
+        if (bKeepPrevious)
+        {
+            Swap(PreviousPositions, PresentedPositions);
+        }
+        else
+        {
+            PreviousPositions.Reset();
+        }
+        Swap(SkinnedPositions, PresentedPositions);
+        Swap(SkinnedTangents, PresentedTangents);
+    }
+
+    /** PreviousPositions가 현재 프론트 버퍼와 보간 가능한지 여부 */
+    bool HasPreviousResult() const
+    {
+        return PreviousPositions.Num() == PresentedPositions.Num() && HasPresentedResult();
+    }
+
+    /** 프론트 버퍼가 현재 Buffer와 크기가 맞아 업로드 가능한지 여부 */
+    bool HasPresentedResult() const
+    {
+        return Buffer && Buffer->Num() > 0 && PresentedPositions.Num() == Buffer->Num() && PresentedTangents.Num() == Buffer->Num() * 2;
+    }
+
+    void Reset()
+    {
+        Buffer = nullptr;
+        SkinnedPositions.Reset();
+        SkinnedTangents.Reset();
+        PresentedPositions.Reset();
+        PresentedTangents.Reset();
+        PreviousPositions.Reset();
+    }
+};
+
+namespace ProcMeshSkinning
+{
+    /**
+     * 스칼라 레퍼런스 커널. 슬롯마다 팔레트 행렬로 위치와 탄젠트 프레임을 변환해 가중 합산합니다.
+     * SIMD 커널 검증용 기준값이므로 최적화보다 명확성을 우선합니다.
+     * @param Buffer 팔레트 압축이 끝난 스키닝 버퍼
+     * @param Palette BuildSkinningPalette로 계산한 팔레트
+     * @param StartVertex 처리할 첫 버텍스 인덱스
+     * @param NumVertices 처리할 버텍스 수
+     * @param OutPositions NumVertices 크기의 출력 (0번이 StartVertex 버텍스)
+     * @param OutTangents NumVertices * 2 크기의 출력 (TangentX, TangentZ 순서. TangentZ.W는 바인드 값 유지)
+     */
+    ADVANCEDACTIONFEATURE_API void SkinVerticesScalar(const FProcMeshSkinningBuffer& Buffer, const FMatrix44f* Palette, int32 StartVertex, int32 NumVertices, FVector3f* OutPositions, FPackedNormal* OutTangents);
+
+    /**
+     * VectorRegister 기반 SIMD 커널. 버텍스마다 슬롯 가중치로 팔레트 행렬 행을 4-wide 레지스터에서 블렌딩한 뒤
+     * 블렌딩된 행렬로 위치와 탄젠트 프레임을 한 번씩만 변환합니다. 인자는 SkinVerticesScalar와 같습니다.
+     */
+    ADVANCEDACTIONFEATURE_API void SkinVerticesSimd(const FProcMeshSkinningBuffer& Buffer, const FMatrix44f* Palette, int32 StartVertex, int32 NumVertices, FVector3f* OutPositions, FPackedNormal* OutTangents);
+
+    /** CVar(AdvancedAction.Skinning.UseSimd / ValidateSimd)에 따라 커널을 선택해 실행합니다. */
+    ADVANCEDACTIONFEATURE_API void SkinVertices(const FProcMeshSkinningBuffer& Buffer, const FMatrix44f* Palette, int32 StartVertex, int32 NumVertices, FVector3f* OutPositions, FPackedNormal* OutTangents);
+
+    /**
+     * 여러 조각의 버텍스를 고정 크기 청크로 나눠 ParallelFor로 한 번에 스키닝합니다.
+     * 각 Job의 Palette는 미리 채워져 있어야 하며, 반환 시점에는 모든 청크가 완료(조인)되어 있습니다.
+     */
+    ADVANCEDACTIONFEATURE_API void SkinJobsParallel(TArrayView<FProcMeshSkinningJob* const> Jobs);
+}
@@ -4,33 +4,101 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "ProcMeshSkinning.h"
+#include "Tasks/Task.h"
+#include "Templates/PimplPtr.h"
 
 #include "SkelToProcMeshComponent.generated.h"
 
 class USkeletalMeshComponent;
+class UMeshComponent;
 class UProceduralMeshComponent;
+class UProcMeshPieceComponent;
 struct FProcMeshTangent; 
+struct FProcMeshCutRequest;
+class UProcMeshCutBakedData;
 class FSkeletalMeshLODRenderData;
-enum class EProcMeshSliceCapOption : uint8;
+class USkelToProcMeshComponent;
 
-USTRUCT(BlueprintType)
-struct FProceduralVertexSkinningData
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FSkelToProcMeshCutCompletedSignature, bool, bSuccess);
+
+/** 런타임 스키닝을 어느 스레드/시점에 수행할지 */
+UENUM(BlueprintType)
+enum class ESkelToProcSkinningMode : uint8
+{
+    // 틱 안에서 스키닝과 업로드를 모두 끝냄 (기존 동작)
+    Synchronous,
+    // Pre-Physics 틱에서 워커 태스크로 스키닝을 시작하고, 같은 프레임 Post-Update-Work에서 결과를 업로드.
+    // 레그돌(물리 시뮬레이션) 중에는 이번 프레임 물리 포즈를 쓰도록 Post-Physics에서 시작 (전환은 다음 프레임부터 적용)
+    Async,
+    // 다음 프레임 틱에서 이전 결과를 업로드하고 새 스키닝을 시작 (한 프레임 지연, 게임 스레드 대기 없음)
+    AsyncOneFrameLatency
+};
+
+/** 스키닝 스로틀링의 프레임별 판정 */
+enum class ESkelToProcSkinningThrottle : uint8
+{
+    // 이번 프레임 스키닝
+    Skin,
+    // 새 스키닝 없이 직전 두 결과를 보간해 업로드
+    Interpolate,
+    // 아무것도 하지 않음 (보이지 않거나 멈춤)
+    Skip
+};
+
+/** 비동기 스키닝 결과를 같은 프레임 후반에 회수하는 보조 틱 함수 */
+USTRUCT()
+struct FSkelToProcMeshSkinningCompletionTickFunction : public FTickFunction
+{
+    GENERATED_BODY()
+
+    USkelToProcMeshComponent* Target = nullptr;
+
+    virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+    virtual FString DiagnosticMessage() override;
+    virtual FName DiagnosticContext(bool bDetailed) override;
+};
+
+template<>
+struct TStructOpsTypeTraits<FSkelToProcMeshSkinningCompletionTickFunction> : public TStructOpsTypeTraitsBase2<FSkelToProcMeshSkinningCompletionTickFunction>
+{
+    enum
+    {
+        WithCopy = false
+    };
+};
+
+/** 절단으로 생긴 프로시저럴 메시 조각 하나 (컴포넌트 + 런타임 스키닝 데이터) */
+USTRUCT()
+struct FSkelToProcMeshPiece
 {
     GENERATED_BODY()
 
-    // 이 프로시저럴 버텍스에 영향을 주는 원본 스켈레탈 메시의 본 인덱스 배열
+    // 조각을 그리는 컴포넌트
+    UPROPERTY()
+    TObjectPtr<UProcMeshPieceComponent> ProcMesh;
+
+    // 조각을 만든 절단 본
+    UPROPERTY()
+    FName SourceBoneName;
+
+    // 같은 변환 호출 안에서의 절단 순번 (GetProcToOriginalVertexIndices의 CutIndex)
     UPROPERTY()
-    TArray<int32> BoneMapIndices; // 스켈레탈 메쉬의 RefSkeleton 본 인덱스
+    int32 CutIndex = INDEX_NONE;
 
-    // 각 본에 대한 가중치 배열 (BoneMapIndices와 순서 일치)
+    // 절단 평면의 음(-)쪽 절반인지 (OtherHalf 부착 규칙을 따름)
     UPROPERTY()
-    TArray<float> BoneWeights;
+    bool bIsOtherHalf = false;
 
-    // 프로시저럴 메시의 로컬 공간(또는 컴포넌트 공간의 바인드 포즈)에서의 원본 버텍스 위치
     UPROPERTY()
-    FVector LocalBindPosePosition;
+    FProcMeshSkinningBuffer SkinningData;
 
-    FProceduralVertexSkinningData() : LocalBindPosePosition(FVector::ZeroVector) {}
+    // SkinningData는 섹션 순서로 이어 붙인 하나의 버텍스 스트림이며, 섹션 S의 버텍스는 [SectionVertexOffsets[S], SectionVertexOffsets[S + 1]) 구간 (섹션 수 + 1, 빈 섹션은 빈 구간)
+    UPROPERTY()
+    TArray<int32> SectionVertexOffsets;
+
+    // 매 틱 재사용하는 스키닝 작업 (팔레트 + 더블 버퍼 커널 출력)
+    FProcMeshSkinningJob SkinningJob;
 };
 
 UCLASS( ClassGroup=(Custom), meta=(BlueprintSpawnableComponent) )
@@ -42,11 +110,50 @@ public:
 
     USkelToProcMeshComponent();
     
+    // 사용자가 지정했거나 소유자에서 찾은 프로시저럴 메시 컴포넌트. 첫 조각의 배치 기준으로만 쓰고, 조각은 그 아래에 붙인 조각 전용 컴포넌트가 그림 (GetPieceMeshes)
     UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category = "Procedural Mesh", meta = (AllowPrivateAccess = "true"))
     TObjectPtr<UProceduralMeshComponent> ProceduralMeshComponent;
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Procedural Mesh|Runtime Skinning")
     bool bEnableRuntimeSkinning = false;
+
+    // 비동기 모드는 BeginPlay 시점에 틱 그룹을 Pre-Physics로 옮기므로 플레이 중 변경은 다음 BeginPlay부터 반영
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Procedural Mesh|Runtime Skinning")
+    ESkelToProcSkinningMode SkinningMode = ESkelToProcSkinningMode::Synchronous;
+
+    // 화면에 보이지 않거나, 멀리 있거나, 멈춘 조각의 스키닝을 줄입니다. (AdvancedAction.Skinning.Throttle 0이면 전역 비활성화)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Procedural Mesh|Runtime Skinning|Throttling")
+    bool bThrottleSkinning = true;
+
+    // 원본 메시와 모든 조각이 이 시간(초) 동안 렌더링되지 않았으면 스키닝하지 않음
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Procedural Mesh|Runtime Skinning|Throttling", meta = (ClampMin = "0"))
+    float NotRenderedSkinningTimeout = 0.5f;
+
+    // 가장 가까운 시점에서 이 거리(cm) 안이면 매 프레임 스키닝
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Procedural Mesh|Runtime Skinning|Throttling", meta = (ClampMin = "0"))
+    float FullRateSkinningDistance = 1500.f;
+
+    // FullRateSkinningDistance에서 이 거리(cm)만큼 멀어질 때마다 스키닝 간격이 한 프레임씩 늘어남
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Procedural Mesh|Runtime Skinning|Throttling", meta = (ClampMin = "1"))
+    float SkinningIntervalDistanceStep = 1500.f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Procedural Mesh|Runtime Skinning|Throttling", meta = (ClampMin = "1"))
+    int32 MaxSkinningInterval = 4;
+
+    // 스키닝하지 않는 프레임에 직전 두 결과를 보간해 업로드합니다. 움직임은 부드러워지지만 (간격 - 1) 프레임 늦게 보이고 업로드 비용은 그대로입니다.
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Procedural Mesh|Runtime Skinning|Throttling")
+    bool bInterpolateThrottledSkinning = true;
+
+    // 래그돌 바디가 모두 잠들면 마지막 포즈로 한 번 스키닝한 뒤 다시 깨어날 때까지 멈춤
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Procedural Mesh|Runtime Skinning|Throttling")
+    bool bFreezeSkinningAtRest = true;
+
+    // 멈춘 상태가 SettleDelay초 이어지면 SettlePieces로 조각을 정적 지오메트리로 굳히고 스키닝 데이터를 해제 (bFreezeSkinningAtRest 필요)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Procedural Mesh|Runtime Skinning|Throttling")
+    bool bSettleAtRest = true;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Procedural Mesh|Runtime Skinning|Throttling", meta = (ClampMin = "0"))
+    float SettleDelay = 2.0f;
     
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Procedural Mesh", meta = (ClampMin = "0"))
     int32 LODIndexToCopy = 0;
@@ -80,138 +187,254 @@ public:
     UPROPERTY(EditDefaultsOnly, Category = "Procedural Mesh")
     float Threshold = 0.01;
 
+    // true이면 절단 본과 그 아래 계층 전체(자식 본)의 가중치 합으로 버텍스를 선택합니다. (위팔을 자르면 아래팔과 손도 함께 잘림)
+    // false이면 절단 본 자신의 가중치만 봅니다.
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Procedural Mesh")
+    bool bCutBoneSubtree = true;
+
     UPROPERTY(EditDefaultsOnly, Category = "Procedural Mesh")
     float ImpulseMagnitude = 10000000;
+
+    // 미리 계산된 본별 절단 결과. 메시/LOD/Threshold/옵션이 맞으면 런타임 지오메트리 생성 대신 사용
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Procedural Mesh")
+    TObjectPtr<UProcMeshCutBakedData> BakedCutData;
     
     UFUNCTION(BlueprintCallable, Category = "Procedural Mesh")
     bool ConvertSkeletalMeshToProceduralMesh(bool bForceNewPMC, FName TargetBoneName);
 
+    /**
+     * 여러 본을 한 번에 절단합니다. 버텍스/인덱스 버퍼를 한 번씩만 훑어 모든 조각을 만들고,
+     * 원본 메시 숨김 오버라이드도 한 번만 업로드합니다.
+     * 여러 절단에 걸친 버텍스는 가중치(bCutBoneSubtree면 서브트리 합)가 가장 큰 절단의 조각에 들어갑니다.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Procedural Mesh")
+    bool ConvertSkeletalMeshToProceduralMeshBatch(bool bForceNewPMC, const TArray<FName>& TargetBoneNames);
+
+    /**
+     * ConvertSkeletalMeshToProceduralMeshBatch의 비동기 버전. 버텍스 선택, 리맵, 탄젠트 재계산, 슬라이스는
+     * 캐시된 렌더 데이터 사본을 읽어 워커 스레드에서 수행하고, 컴포넌트 생성과 원본 숨김은 게임 스레드에서 마무리한 뒤 OnCutCompleted를 호출합니다.
+     * 이전 조각은 마무리 시점까지 그대로 유지됩니다. 진행 중인 절단이 있으면 취소하고 새로 시작합니다.
+     * 예산 관리자(UProcMeshCutBudgetSubsystem)가 켜져 있으면 요청은 큐에 들어가 프레임 예산 안에서 시작되며,
+     * 그때 시작하지 못하면 OnCutCompleted(false)가 호출됩니다.
+     * @return 절단을 시작했거나 큐에 넣었으면 true (즉시 시작하지 못하면 OnCutCompleted는 호출되지 않음)
+     */
+    UFUNCTION(BlueprintCallable, Category = "Procedural Mesh")
+    bool ConvertSkeletalMeshToProceduralMeshAsync(bool bForceNewPMC, const TArray<FName>& TargetBoneNames);
+
+    /** 비동기 절단이 진행 중이거나 예산 관리자 큐에서 대기 중인지 여부 */
+    UFUNCTION(BlueprintPure, Category = "Procedural Mesh")
+    bool IsCutInProgress() const { return bCutInProgress || bCutQueued; }
+
+    // 절단이 끝나면 호출 (동기/비동기 모두). 조각은 GetPieceMeshes로 조회
+    UPROPERTY(BlueprintAssignable, Category = "Procedural Mesh")
+    FSkelToProcMeshCutCompletedSignature OnCutCompleted;
+
+    /** 현재 조각들의 메시 컴포넌트 (절단 순서, 본마다 양(+)쪽 -> 음(-)쪽). 조각 전용 UProcMeshPieceComponent는 UProceduralMeshComponent가 아님 */
+    UFUNCTION(BlueprintPure, Category = "Procedural Mesh")
+    TArray<UMeshComponent*> GetPieceMeshes() const;
+
+    /** 조각은 모두 UProcMeshPieceComponent이므로 항상 비어 있음. GetPieceMeshes를 사용 */
+    UFUNCTION(BlueprintPure, Category = "Procedural Mesh", meta = (DeprecatedFunction, DeprecationMessage = "조각은 UProceduralMeshComponent가 아닙니다. GetPieceMeshes를 사용하세요."))
+    TArray<UProceduralMeshComponent*> GetPieceProceduralMeshes() const;
+
     UFUNCTION(BlueprintCallable, Category = "Procedural Mesh|Runtime Skinning")
     void UpdateProceduralMeshesSkinning();
 
+    /**
+     * 조각을 현재 스키닝된 포즈로 굳힙니다. 모든 섹션에 마지막 포즈를 올리고 조각을 절단 본에 고정한 뒤,
+     * 스키닝 버퍼/잡, 역 바인드 행렬, 절단 빌더 스크래치를 해제하고 틱을 끕니다.
+     * 이후에는 다시 스키닝할 수 없으며, 새로 절단하면 다시 스키닝 가능한 조각이 만들어집니다.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Procedural Mesh|Runtime Skinning")
+    void SettlePieces();
+
+    /** 조각이 SettlePieces로 굳어 있는지 여부 */
+    UFUNCTION(BlueprintPure, Category = "Procedural Mesh|Runtime Skinning")
+    bool IsSettled() const { return bSettled; }
+
+    /** 원본 LOD 버텍스 인덱스 -> 소속 절단의 슬라이스 전 프로시저럴 버텍스 인덱스 (선택되지 않은 버텍스는 INDEX_NONE) */
+    TConstArrayView<int32> GetOriginalToProcVertexIndices() const { return OriginalToProcVertexIndices; }
+
+    /** 원본 LOD 버텍스 인덱스 -> 소속 절단 순번 (선택되지 않은 버텍스는 NoCutIndex) */
+    TConstArrayView<uint8> GetOriginalToCutIndices() const { return OriginalToCutIndices; }
+
+    /** 절단 CutIndex의 슬라이스 전 프로시저럴 버텍스 인덱스 -> 원본 LOD 버텍스 인덱스 */
+    TConstArrayView<int32> GetProcToOriginalVertexIndices(int32 CutIndex = 0) const
+    {
+        return CutProcToOriginalVertexIndices.IsValidIndex(CutIndex) ? TConstArrayView<int32>(CutProcToOriginalVertexIndices[CutIndex]) : TConstArrayView<int32>();
+    }
+
+    // 절단되지 않은 버텍스의 절단 순번. 한 번에 절단할 수 있는 본은 NoCutIndex개 미만
+    static constexpr uint8 NoCutIndex = 0xFF;
+
+    /**
+     * 절단된 버텍스를 숨기는 버텍스 컬러 오버라이드 배열을 만듭니다 (기존 컬러 또는 흰색, 숨길 버텍스는 알파 0).
+     * @return 숨길 버텍스 수. 0이면 OutOverrideColors는 비어 있음
+     */
+    static int32 BuildHiddenVertexColors(const FSkeletalMeshLODRenderData& LODRenderData, TConstArrayView<uint8> InOriginalToCutIndices, TArray<FLinearColor>& OutOverrideColors);
+
 protected:
 
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+    virtual void RegisterComponentTickFunctions(bool bRegister) override;
 
 
 private:
 
+    friend struct FSkelToProcMeshSkinningCompletionTickFunction;
+    friend class UProcMeshCutBudgetSubsystem;
+
+    /** 조각별 스키닝 작업의 팔레트를 현재 포즈로 채웁니다. 스키닝할 조각이 하나라도 있으면 true */
+    bool PrepareSkinningJobs();
+
+    /** 비동기 스키닝 태스크를 시작합니다. */
+    void KickAsyncSkinning();
+
+    /** 비동기 모드의 주 틱 그룹을 고릅니다. 레그돌이면 물리 이후, 아니면 Pre-Physics */
+    void UpdateSkinningTickGroup();
+
+    /** 진행 중인 비동기 스키닝이 있으면 완료를 기다리고 결과를 표시 버퍼로 넘깁니다. */
+    void CompleteAsyncSkinning();
+
+    /**
+     * 표시 버퍼에 있는 스키닝 결과를 프로시저럴 메시 섹션에 업로드합니다.
+     * bMustPresent이거나 멈춘 포즈를 올리는 중이면 렌더 스레드가 밀려 있어도 프레임을 버리지 않고 기다림 (다시 올릴 기회가 없음)
+     */
+    void UploadPresentedSkinning(bool bMustPresent = false);
 
     /** Procedural Mesh Component를 가져오거나 생성하는 헬퍼 함수 */
     bool SetupProceduralMeshComponent(bool bForceNew);
 
-    /** Skeletal Mesh LOD 섹션에서 Procedural Mesh로 메쉬 데이터를 복사하는 함수 */
-    bool CopySkeletalLODToProcedural(USkeletalMeshComponent* SkelComp, FName TargetBoneName, int32 LODIndex);
-
-    /** Skeletal Mesh LOD에서 필요한 데이터 버퍼를 추출하는 함수 */
-    // 아래 함수 시그니처 변경: 스키닝 정보 빌드를 위해 OriginalToProcVertexMap을 반환하도록 함
-
-    bool GetFilteredSkeletalMeshDataByBoneName(
-        const USkeletalMeshComponent* SkelComp,
-        FName TargetBoneName,
-        float MinWeight,
-        int32 LODIndex,
-        TArray<FVector>& OutVertices,       // 출력: 버텍스 위치 배열
-        TArray<FVector>& OutNormals,        // 출력: 노멀 배열
-        TArray<FProcMeshTangent>& OutTangents, // 출력: 탄젠트 배열
-        TArray<FVector2D>& OutUV0,          // 출력: UV0 배열
-        TArray<FLinearColor>& OutVertexColors, // 출력: 버텍스 컬러 배열
-        TArray<int32>& SectionMaterialIndices, // 출력: 각 섹션의 머티리얼 인덱스 배열
-        TArray<TArray<int32>>& SectionIndices, // 출력: 각 섹션의 인덱스(트라이앵글) 배열
-        TMap<uint32, uint32>& OutOriginalToProcVertexMap // 이 맵을 채워서 반환
-        );
+    /**
+     * 절단 요청을 검증하고 워커가 읽을 입력(렌더 데이터 사본, 본 -> 절단 테이블, 절단 평면)을 CutRequest에 채웁니다. 게임 스레드 전용
+     * @return 지오메트리 단계를 실행할 수 있으면 true
+     */
+    bool BeginCut(bool bForceNewPMC, TConstArrayView<FName> TargetBoneNames);
+
+    /** 지오메트리 단계가 끝난 절단을 게임 스레드에서 마무리하고 OnCutCompleted를 호출합니다. */
+    bool FinishCut();
 
-    
+    /** 절단 결과로 조각 컴포넌트를 만들고, 원본 메시를 숨기고, 레그돌로 전환합니다. */
+    bool CreatePiecesFromCutResult();
 
-    bool SliceMesh(
-        UProceduralMeshComponent* InProcMesh,
-        FVector PlanePosition,
-        FVector PlaneNormal,
-        bool bCreateOtherHalf,
-        UProceduralMeshComponent*& OutOtherHalfProcMesh,
-        EProcMeshSliceCapOption CapOption,
-        UMaterialInterface* CapMaterial
-        );
+    /** 진행 중인 비동기 절단이 있으면 워커를 기다린 뒤 결과를 버립니다. */
+    void CancelPendingCut();
 
+    /** 이전 조각의 컴포넌트를 재사용하거나, 월드 풀에서 빌리거나, 새 조각 컴포넌트를 만듭니다. */
+    UProcMeshPieceComponent* AcquirePieceProceduralMesh(TArray<TObjectPtr<UProcMeshPieceComponent>>& ReusableProcMeshes);
 
-    
-    float GetBoneWeightForVertex(int32 VertexIndex, int32 TargetBoneIndex,  const FSkelMeshRenderSection* SkelMeshRenderSection, const FSkeletalMeshLODRenderData* LODRenderData, const FSkinWeightVertexBuffer* SkinWeightBuffer);
+    /** 더 이상 쓰지 않는 조각 컴포넌트를 월드 풀에 돌려주거나, 풀이 없으면 파괴합니다. */
+    void ReleasePieceProceduralMesh(UProcMeshPieceComponent* ProcMesh);
 
     /** 소유자에서 대상 Skeletal Mesh Component를 찾는 헬퍼 함수 */
     USkeletalMeshComponent* GetOwnerSkeletalMeshComponent() const;
 
     /**
-     * 원본 스켈레탈 메시 컴포넌트에서 특정 본에 연결된 버텍스들을 숨깁니다.
+     * 원본 스켈레탈 메시 컴포넌트에서 절단된 버텍스들을 숨깁니다. 버텍스 컬러 오버라이드는 한 번만 업로드합니다.
      * @param SourceSkeletalMeshComp 숨길 대상 스켈레탈 메시 컴포넌트
      * @param LODIndex 처리할 LOD 인덱스
-     * @param TargetBoneName 숨길 기준이 되는 본의 이름
-     * @param Threshold 가중치 임계값 (이 값보다 커야 숨김 처리)
+     * @param InOriginalToCutIndices 원본 LOD 버텍스 -> 소속 절단 (NoCutIndex가 아니면 숨김)
      * @param bClearOverride 숨길 버텍스가 없을 때 이전 오버라이드를 제거할지 여부
      * @return 성공 여부
      */
-    
-    bool HideOriginalMeshVerticesByBone(USkeletalMeshComponent* SourceSkeletalMeshComp, int32 LODIndex, FName TargetBoneName, bool bClearOverride = true);
-    
-  /**
-     * Procedural Mesh 생성을 위해 필터링된 버텍스들의 스키닝 정보를 빌드합니다.
-     * @param SkelComp 소스 스켈레탈 메시 컴포넌트
-     * @param LODIndex 대상 LOD 인덱스
-     * @param InProcMeshVertices 프로시저럴 메쉬를 구성하는 로컬 바인드 포즈상의 버텍스 위치들
-     * @param InOriginalToProcVertexMap 원본 스켈레탈 메쉬 버텍스 인덱스에서 현재 프로시저럴 메쉬의 버텍스 인덱스로의 매핑
-     * @param OutSkinningData 결과를 저장할 스키닝 데이터 배열
-     * @return 성공 여부
-     */
-    bool BuildSkinningDataForProceduralMesh(
-        const USkeletalMeshComponent* SkelComp,
-        int32 LODIndex,
-        const TArray<FVector>& InProcMeshVertices,
-        const TMap<uint32, uint32>& InOriginalToProcVertexMap, // Key: Original SkelMesh VertexIdx, Value: ProcMesh VertexIdx for InProcMeshVertices
-        TArray<FProceduralVertexSkinningData>& OutSkinningData);
+    bool HideOriginalMeshVertices(USkeletalMeshComponent* SourceSkeletalMeshComp, int32 LODIndex, TConstArrayView<uint8> InOriginalToCutIndices, bool bClearOverride = true);
 
-    /**
-     * 원본 스켈레탈 메시의 특정 버텍스에 대한 스킨 웨이트 정보를 가져옵니다.
-     * @param SkelComp 소스 스켈레탈 메시 컴포넌트
-     * @param OriginalSkelVertexIndex 스키닝 정보를 가져올 원본 스켈레탈 메시의 버텍스 인덱스
-     * @param LODRenderData 해당 LOD의 렌더 데이터
-     * @param SkinWeightBuffer 스킨 웨이트 버퍼
-     * @param OutVertexSkinningData 결과를 저장할 구조체 (BoneMapIndices, BoneWeights 채워짐)
-     * @return 성공 여부
-     */
-    bool GetSkinWeightsForOriginalVertex(
-        const USkeletalMeshComponent* SkelComp,
-        uint32 OriginalSkelVertexIndex,
-        const FSkeletalMeshLODRenderData& LODRenderData, // 직접 포함 대신 전방선언 후 cpp에서 include
-        const FSkinWeightVertexBuffer* SkinWeightBuffer, // 직접 포함 대신 전방선언 후 cpp에서 include
-        FProceduralVertexSkinningData& OutVertexSkinningData);
+    /** 가시성/거리/정지 상태로 이번 프레임의 스키닝 여부를 정하고 스로틀 카운터를 진행합니다. */
+    ESkelToProcSkinningThrottle EvaluateSkinningThrottle();
+
+    /** 가장 가까운 렌더링 시점과의 거리로 스키닝 간격(프레임)을 계산합니다. */
+    int32 ComputeSkinningInterval(const USkeletalMeshComponent& SkelComp) const;
+
+    /** 완료된 스키닝 잡들을 프론트 버퍼로 넘깁니다. 보간이 켜져 있으면 직전 결과를 남깁니다. */
+    void PresentSkinningJobs();
+
+    /** 큐를 거치지 않고 비동기 절단을 시작합니다. (ConvertSkeletalMeshToProceduralMeshAsync, 예산 관리자) */
+    bool StartCutAsync(bool bForceNewPMC, const TArray<FName>& TargetBoneNames);
 
+    /** 현재 조각들의 스키닝 버텍스 수 합 (예산 배분용) */
+    int32 GetNumSkinningVertices() const;
+
+    /** 조각 수/스키닝 메모리 카운터를 현재 조각 기준으로 갱신합니다. bRelease면 이 컴포넌트 몫을 모두 뺍니다. */
+    void UpdatePieceStats(bool bRelease);
+    
 
     // --- 멤버 변수 추가 ---
 
-    // 주 프로시저럴 메시 컴포넌트에 대한 스키닝 데이터
-    UPROPERTY()
-    TArray<FProceduralVertexSkinningData> MainProcMeshSkinningData;
+    // 첫 조각 컴포넌트 (만들거나 풀에서 빌림. ProceduralMeshComponent가 있으면 그 아래에 붙음)
+    UPROPERTY(Transient)
+    TObjectPtr<UProcMeshPieceComponent> FirstPieceMesh;
 
-    // 절단된 다른 쪽 프로시저럴 메시 컴포넌트에 대한 스키닝 데이터
+    // 절단으로 생긴 조각들. 첫 조각은 FirstPieceMesh를 사용
     UPROPERTY()
-    TArray<FProceduralVertexSkinningData> OtherHalfProcMeshSkinningData;
+    TArray<FSkelToProcMeshPiece> Pieces;
+
+    // 이번 틱에 스키닝할 조각들의 작업 (PrepareSkinningJobs에서 채우고 커널/회수 단계가 읽음)
+    TArray<FProcMeshSkinningJob*> ActiveSkinningJobs;
 
     // 원본 스켈레탈 메시의 각 본에 대한 역 바인드 포즈 변환 행렬 (컴포넌트 공간 기준)
     UPROPERTY()
-    TArray<FMatrix> RefBoneInverseBindMatrices;
+    TArray<FMatrix44f> RefBoneInverseBindMatrices;
 
-    // 생성된 다른 쪽 프로시저럴 메시 컴포넌트의 참조 (업데이트를 위해 저장)
-    UPROPERTY()
-    TObjectPtr<UProceduralMeshComponent> OtherHalfProceduralMeshComponent;
+    // 진행 중인 비동기 스키닝 태스크 (Async/AsyncOneFrameLatency 모드)
+    UE::Tasks::FTask PendingSkinningTask;
+
+    // Async 모드에서 같은 프레임 후반에 결과를 회수하는 틱 함수
+    FSkelToProcMeshSkinningCompletionTickFunction SkinningCompletionTick;
+
+    // 절단 입력/출력과 빌더(슬라이서 포함) 스크래치. 절단 사이에 재사용하며, 비동기 절단 중에는 워커가 소유
+    TPimplPtr<FProcMeshCutRequest> CutRequest;
+
+    // 진행 중인 비동기 절단의 지오메트리 태스크
+    UE::Tasks::FTask PendingCutTask;
+
+    // 절단 요청 번호. 예약된 게임 스레드 마무리가 취소된 요청인지 확인용
+    uint32 CutSerial = 0;
+
+    // BeginCut ~ FinishCut 사이인지 여부
+    bool bCutInProgress = false;
+
+    // 진행 중(또는 마지막) 절단의 요청 내용. 마무리 단계에서 사용
+    TArray<FName> CutBoneNames;
+    int32 CutLODIndex = 0;
+    bool bCutForceNewPMC = false;
+
+    // 절단 지오메트리 단계에서 생성되는 밀집 리맵 테이블 (절단별 슬라이스 전 지오메트리 기준).
+    // 원본 LOD 버텍스 수 크기이며 선택되지 않은 버텍스는 INDEX_NONE.
+    // 슬라이스 이후 양쪽 절반의 버텍스는 FProcMeshVertexProvenance로 이 테이블의 ProcMesh 버텍스를 가리킴
+    TArray<int32> OriginalToProcVertexIndices;
+
+    // 원본 LOD 버텍스 -> 소속 절단 순번 (NoCutIndex면 절단되지 않음)
+    TArray<uint8> OriginalToCutIndices;
+
+    // 절단별 역방향 테이블 (ProcMesh 버텍스 -> 원본 LOD 버텍스)
+    TArray<TArray<int32>> CutProcToOriginalVertexIndices;
+
+    // 전역 카운터(stat AdvancedAction, CSV)에 마지막으로 반영한 이 컴포넌트의 조각 수/스키닝 데이터 크기
+    int32 TrackedNumPieces = 0;
+    SIZE_T TrackedSkinningDataBytes = 0;
+
+    // 예산 관리자 큐에서 대기 중인 절단이 있는지
+    bool bCutQueued = false;
+
+    // 예산 관리자가 이번 프레임 스키닝을 허가했는지와, 허가받지 못하고 밀린 프레임 수
+    bool bSkinningGranted = true;
+    int32 SkinningWaitFrames = 0;
+
+    // 스로틀링 상태: 마지막 스키닝 때의 간격, 그 뒤로 지난 프레임 수
+    int32 SkinningInterval = 1;
+    int32 SkinningFrameCounter = 0;
 
+    // 잠든 래그돌의 마지막 포즈를 이미 스키닝했는지, 그때의 월드 시간
+    bool bSkinningFrozenAtRest = false;
+    double FrozenAtRestTime = 0.0;
 
-    // GetFilteredSkeletalMeshDataByBoneName에서 생성되는, 원본 스켈레탈 메쉬 버텍스 인덱스 -> Procedural Mesh 버텍스 인덱스 맵.
-    // 스키닝 정보 빌드 시 필요.
-    // Key: Original SkelMesh Vertex Index, Value: ProcMesh Vertex Index (MainProcMesh 용)
-    TMap<uint32, uint32> OriginalToMainProcVertexMap;
+    // SettlePieces로 스키닝 데이터를 해제했는지
+    bool bSettled = false;
 
-    // (OtherHalf 용 맵도 필요하다면 선언. SliceMesh의 결과에 따라 복잡도가 달라짐)
-    // TMap<uint32, uint32> OriginalToOtherHalfProcVertexMap;
+    // 건너뛴 뒤 다시 스키닝할 때 오래된 결과에서 보간하지 않도록 직전 결과를 버림
+    bool bResetSkinningHistory = true;
 
 };
 
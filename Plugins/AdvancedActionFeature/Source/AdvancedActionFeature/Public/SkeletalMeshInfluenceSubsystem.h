@@ -0,0 +1,162 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/EngineSubsystem.h"
+#include "UObject/ObjectKey.h"
+
+#include "SkeletalMeshInfluenceSubsystem.generated.h"
+
+class USkeletalMesh;
+class FSkeletalMeshLODRenderData;
+
+/**
+ * 스켈레탈 메시 LOD 하나에 대한 본 -> 버텍스 인플루언스 역색인 (CSR).
+ * 본 B에 가중치를 가진 버텍스들은 VertexIndices[BoneOffsets[B] .. BoneOffsets[B + 1]) 구간에
+ * 버텍스 인덱스 오름차순으로 들어 있고, 같은 위치의 VertexWeights가 0~1 가중치입니다.
+ * 빌드 이후에는 불변이므로 여러 스레드에서 동시에 읽어도 안전합니다.
+ */
+struct ADVANCEDACTIONFEATURE_API FSkeletalMeshBoneInfluenceIndex
+{
+    // 색인을 만든 LOD의 버텍스 수
+    int32 NumVertices = 0;
+
+    // 본별 구간 시작 위치 (본 수 + 1)
+    TArray<int32> BoneOffsets;
+
+    // 본별로 묶인 버텍스 인덱스
+    TArray<int32> VertexIndices;
+
+    // VertexIndices와 1:1로 대응하는 가중치 (같은 본을 여러 슬롯에서 참조하면 합산)
+    TArray<float> VertexWeights;
+
+    /** LOD 렌더 데이터의 스킨 웨이트 버퍼를 한 번 훑어 색인을 만듭니다. */
+    void Build(const FSkeletalMeshLODRenderData& LODRenderData, int32 NumBones);
+
+    int32 NumBones() const { return FMath::Max(BoneOffsets.Num() - 1, 0); }
+
+    /** 본에 가중치를 가진 버텍스 목록. 범위를 벗어난 본이면 빈 뷰 */
+    TConstArrayView<int32> GetBoneVertices(int32 BoneIndex) const
+    {
+        if (BoneIndex < 0 || BoneIndex >= NumBones()) return TConstArrayView<int32>();
+        return TConstArrayView<int32>(VertexIndices.GetData() + BoneOffsets[BoneIndex], BoneOffsets[BoneIndex + 1] - BoneOffsets[BoneIndex]);
+    }
+
+    /** GetBoneVertices와 같은 순서의 가중치 */
+    TConstArrayView<float> GetBoneWeights(int32 BoneIndex) const
+    {
+        if (BoneIndex < 0 || BoneIndex >= NumBones()) return TConstArrayView<float>();
+        return TConstArrayView<float>(VertexWeights.GetData() + BoneOffsets[BoneIndex], BoneOffsets[BoneIndex + 1] - BoneOffsets[BoneIndex]);
+    }
+
+    SIZE_T GetAllocatedSize() const
+    {
+        return BoneOffsets.GetAllocatedSize() + VertexIndices.GetAllocatedSize() + VertexWeights.GetAllocatedSize();
+    }
+};
+
+/**
+ * 절단에 필요한 스켈레탈 메시 LOD 렌더 데이터의 불변 CPU 사본.
+ * 렌더 데이터 버퍼 대신 이 사본을 읽으면 워커 스레드에서도 안전하게 지오메트리를 추출할 수 있습니다.
+ * 인플루언스는 렌더 섹션 BoneMap을 거쳐 스켈레톤 본 인덱스로 미리 변환해 둡니다.
+ */
+struct ADVANCEDACTIONFEATURE_API FSkeletalMeshLODSourceData
+{
+    struct FSection
+    {
+        int32 MaterialIndex = 0;
+        uint32 BaseIndex = 0;
+        uint32 NumTriangles = 0;
+    };
+
+    TArray<FVector3f> Positions;
+    TArray<FVector3f> TangentsX;
+
+    // 노멀. W는 바이노멀 부호 (음수면 미러링된 UV, FProcMeshTangent::bFlipTangentY)
+    TArray<FVector4f> TangentsZ;
+    TArray<FVector2f> UV0;
+
+    // 컬러 버퍼가 없으면 비어 있음
+    TArray<FColor> Colors;
+
+    TArray<uint32> Indices;
+    TArray<FSection> Sections;
+
+    // 버텍스당 인플루언스 슬롯 수. 슬롯 레이아웃은 [VertexIndex * MaxInfluences + Slot], 빈 슬롯은 가중치 0
+    int32 MaxInfluences = 0;
+    TArray<uint16> InfluenceBones;
+    TArray<float> InfluenceWeights;
+
+    /** LOD 렌더 데이터의 정적 버텍스/인덱스/스킨 웨이트 버퍼를 복사합니다. */
+    void Build(const FSkeletalMeshLODRenderData& LODRenderData);
+
+    int32 NumVertices() const { return Positions.Num(); }
+
+    SIZE_T GetAllocatedSize() const
+    {
+        return Positions.GetAllocatedSize() + TangentsX.GetAllocatedSize() + TangentsZ.GetAllocatedSize() + UV0.GetAllocatedSize()
+            + Colors.GetAllocatedSize() + Indices.GetAllocatedSize() + Sections.GetAllocatedSize()
+            + InfluenceBones.GetAllocatedSize() + InfluenceWeights.GetAllocatedSize();
+    }
+};
+
+/**
+ * 스켈레탈 메시 에셋/LOD별 본 -> 버텍스 인플루언스 색인과 LOD 렌더 데이터 사본을 공유하는 엔진 서브시스템.
+ * 처음 요청될 때 한 번만 빌드하고, 같은 메시를 쓰는 모든 USkelToProcMeshComponent가 재사용합니다.
+ * 절단 시 LOD 전체를 훑는 대신 대상 본의 버텍스만 방문할 수 있고, 지오메트리 추출을 워커 스레드로 넘길 수 있습니다.
+ */
+UCLASS()
+class ADVANCEDACTIONFEATURE_API USkeletalMeshInfluenceSubsystem : public UEngineSubsystem
+{
+    GENERATED_BODY()
+
+public:
+
+    typedef TSharedPtr<const FSkeletalMeshBoneInfluenceIndex, ESPMode::ThreadSafe> FInfluenceIndexPtr;
+    typedef TSharedPtr<const FSkeletalMeshLODSourceData, ESPMode::ThreadSafe> FLODSourceDataPtr;
+
+    /** GEngine이 없으면(예: 모듈 로드 초기) nullptr */
+    static USkeletalMeshInfluenceSubsystem* Get();
+
+    virtual void Deinitialize() override;
+
+    /**
+     * 메시/LOD의 인플루언스 색인을 가져옵니다. 캐시에 없으면 새로 빌드합니다.
+     * 렌더 데이터를 읽고 UObject를 확인하므로 게임 스레드에서 호출하며, 반환된 색인은 어느 스레드에서든 읽을 수 있습니다.
+     * 에디터에서 메시 렌더 데이터가 다시 빌드되면 캐시가 무효화되지만, 이미 반환된 포인터는 계속 유효합니다.
+     * @return 렌더 데이터나 스킨 웨이트 버퍼가 없으면 nullptr
+     */
+    FInfluenceIndexPtr GetInfluenceIndex(const USkeletalMesh* SkeletalMesh, int32 LODIndex);
+
+    /**
+     * 메시/LOD의 렌더 데이터 사본을 가져옵니다. 렌더 데이터를 읽으므로 게임 스레드에서 호출하며,
+     * 반환된 사본은 어느 스레드에서든 읽을 수 있습니다. 캐시 규칙은 GetInfluenceIndex와 같습니다.
+     * @return 렌더 데이터가 없거나 버텍스가 없으면 nullptr
+     */
+    FLODSourceDataPtr GetLODSourceData(const USkeletalMesh* SkeletalMesh, int32 LODIndex);
+
+    /** 메시의 모든 LOD 색인과 사본을 캐시에서 제거합니다. (에디터 재빌드 시 자동 호출) */
+    void InvalidateMesh(const USkeletalMesh* SkeletalMesh);
+
+private:
+
+    /** 가비지 컬렉션된 메시의 항목을 정리합니다. 게임 스레드에서 CacheLock을 잡은 상태로 호출 */
+    void PurgeStaleEntries();
+
+#if WITH_EDITOR
+    /** 메시 렌더 데이터가 다시 빌드되면 InvalidateMesh가 불리도록 메시마다 한 번 구독합니다. */
+    void WatchMeshRebuild(const USkeletalMesh* SkeletalMesh);
+
+    // 구독 중인 메시별 재빌드 델리게이트 핸들
+    TMap<TObjectKey<USkeletalMesh>, FDelegateHandle> MeshRebuildHandles;
+#endif
+
+    typedef TPair<TObjectKey<USkeletalMesh>, int32> FCacheKey;
+
+    TMap<FCacheKey, FInfluenceIndexPtr> InfluenceIndices;
+    TMap<FCacheKey, FLODSourceDataPtr> LODSourceData;
+
+    // 조회/빌드는 게임 스레드 전용. 에디터 재빌드 콜백 등 다른 경로의 InvalidateMesh와 겹치지 않도록 캐시 맵만 보호
+    FCriticalSection CacheLock;
+};